@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Benchmark comparing the key lookup performance of the @ref mpicxx::info and @ref mpicxx::indexed_info classes.
+ * @details For each info object size, the time needed to look up every key once (using `find` and `contains`) is measured for both
+ *          classes. Additionally, the one time cost of building the hash index is reported. The crossover point is the smallest size
+ *          at which the @ref mpicxx::indexed_info is faster, including the costs for building its hash index.
+ *
+ *          Usage: `mpirun -np 1 ./benchmark_indexed_info [repetitions]`
+ */
+
+#include <mpicxx/chrono/clock.hpp>
+#include <mpicxx/info/indexed_info.hpp>
+#include <mpicxx/info/info.hpp>
+
+#include <fmt/format.h>
+#include <mpi.h>
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+// measures the time (in µs) needed to call func 'repetitions' times
+template <typename Func>
+double measure(const int repetitions, Func&& func) {
+    const auto start = mpicxx::clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        func();
+    }
+    const auto end = mpicxx::clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / repetitions;
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+    {
+        const int repetitions = argc > 1 ? std::stoi(argv[1]) : 100;
+
+        fmt::print("{:>6} | {:>14} | {:>14} | {:>14} | {:>14} | {:>14}\n",
+                "size", "info::find", "indexed::find", "info::contains", "indexed::cont.", "indexed build");
+        fmt::print("{:-^92}\n", "");
+
+        std::optional<std::size_t> crossover;
+        std::size_t found = 0;
+        for (std::size_t size = 1; size <= 256; size *= 2) {
+            // create keys and info objects
+            std::vector<std::string> keys;
+            keys.reserve(size);
+            mpicxx::info info;
+            for (std::size_t i = 0; i < size; ++i) {
+                keys.emplace_back(fmt::format("key{}", i));
+                info.insert(keys.back(), fmt::format("value{}", i));
+            }
+
+            // measure the costs of building the hash index
+            mpicxx::indexed_info indexed{ mpicxx::info(info) };
+            const double build = measure(repetitions, [&]() { indexed.reindex(); });
+
+            // measure lookup costs (all keys looked up once)
+            const double info_find = measure(repetitions, [&]() {
+                for (const std::string& key : keys) { found += info.find(key) != info.end(); }
+            });
+            const double indexed_find = measure(repetitions, [&]() {
+                for (const std::string& key : keys) { found += indexed.find(key) != indexed.end(); }
+            });
+            const double info_contains = measure(repetitions, [&]() {
+                for (const std::string& key : keys) { found += info.contains(key); }
+            });
+            const double indexed_contains = measure(repetitions, [&]() {
+                for (const std::string& key : keys) { found += indexed.contains(key); }
+            });
+
+            fmt::print("{:>6} | {:>11.3f} µs | {:>11.3f} µs | {:>11.3f} µs | {:>11.3f} µs | {:>11.3f} µs\n",
+                    size, info_find, indexed_find, info_contains, indexed_contains, build);
+
+            if (!crossover.has_value() && indexed_find + build < info_find) {
+                crossover = size;
+            }
+        }
+
+        if (crossover.has_value()) {
+            fmt::print("\ncrossover (index build + one lookup per key faster than plain info lookups): size {}\n", crossover.value());
+        } else {
+            fmt::print("\nno crossover found: plain info lookups are always faster for one lookup per key\n");
+        }
+        fmt::print("(checksum: {})\n", found);
+    }
+    MPI_Finalize();
+    return 0;
+}
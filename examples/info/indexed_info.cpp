@@ -0,0 +1,39 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Examples for the @ref mpicxx::indexed_info implementation.
+ */
+
+//! [mwe]
+#include <iostream>
+
+#include <mpicxx/info/indexed_info.hpp>
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+    {
+        // build the hash index once for an existing info object
+        mpicxx::info info = {{ "key1", "value1" }, { "key2", "value2" }};
+        mpicxx::indexed_info indexed(std::move(info));
+
+        // lookups only cost a single hash probe
+        if (indexed.contains("key1")) {
+            std::cout << "key found!" << std::endl;
+        }
+        auto it = indexed.find("key2");
+        std::cout << (*it).second << std::endl;
+
+        // modifications keep the hash index in sync
+        indexed.insert_or_assign("key3", "value3");
+        indexed.erase("key1");
+
+        // pass the underlying MPI_Info object to a MPI function
+        MPI_Info mpi_info = indexed.get();
+    }
+    MPI_Finalize();
+    return 0;
+}
+//! [mwe]
@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Examples for some functions of the @ref mpicxx::communication_proxy implementation.
+ */
+
+//! [communication proxy]
+// MPI_THREAD_FUNNELED is sufficient: only the main thread ever issues MPI calls
+mpicxx::init(mpicxx::thread_support::funneled);
+{
+    mpicxx::communication_proxy proxy;
+
+    std::atomic<int> finished = 0;
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 4; ++w) {
+        workers.emplace_back([&, w]() {
+            std::vector<double> send = compute(w), recv(send.size());
+            // the callables get executed by the main thread (the tag distinguishes the workers)
+            std::future<std::array<MPI_Request, 2>> requests = proxy.submit([&]() {
+                std::array<MPI_Request, 2> req;
+                MPI_Isend(send.data(), send.size(), MPI_DOUBLE, partner, w, MPI_COMM_WORLD, &req[0]);
+                MPI_Irecv(recv.data(), recv.size(), MPI_DOUBLE, partner, w, MPI_COMM_WORLD, &req[1]);
+                return req;
+            });
+            std::array<MPI_Request, 2> req = requests.get();
+            // never block the main thread: poll the completion instead
+            while (!proxy.submit([&]() { int flag; MPI_Testall(2, req.data(), &flag, MPI_STATUSES_IGNORE); return flag != 0; }).get()) {
+                std::this_thread::yield();
+            }
+            use(recv);
+            ++finished;
+        });
+    }
+
+    // the main thread drives the communication until all workers are done
+    proxy.run_until([&]() { return finished == 4; });
+    for (std::thread& t : workers) {
+        t.join();
+    }
+}
+mpicxx::finalize();
+//! [communication proxy]
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Examples for some functions of the @ref mpicxx::elastic_group implementation.
+ */
+
+//! [elastic group]
+// create a group containing all processes of MPI_COMM_WORLD (the workers get spawned from the executable "worker.out")
+mpicxx::elastic_group group(mpicxx::single_spawner("worker.out", 1));
+
+// under load: spawn four additional workers (all members, including the already running workers, must take part)
+broadcast_instruction(group.communicator(), instruction::grow, 4);
+group.grow(4);
+
+// use the group's communicator spanning the parents and all live workers
+MPI_Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, group.communicator());
+
+// idle: release the two most recently spawned workers
+broadcast_instruction(group.communicator(), instruction::shrink, 2);
+group.shrink(2);
+//! [elastic group]
+//! [elastic group worker]
+// worker.out: join the group and follow the instructions of the parent with rank 0
+mpicxx::elastic_group group = mpicxx::elastic_group::join();
+for (;;) {
+    const auto [inst, n] = receive_instruction(group.communicator());
+    if (inst == instruction::grow) {
+        group.grow(n);
+    } else if (inst == instruction::shrink && !group.shrink(n)) {
+        // this worker has been released
+        break;
+    }
+    // ...
+}
+//! [elastic group worker]
@@ -74,4 +74,40 @@ int main(int argc, char** argv) {
     // can't make any mistake related to initialization or finalization!
     return mpicxx::main(&mpicxx_main, argc, argv, mpicxx::thread_support::multiple);
 }
-//! [mpicxx_main version with args and thread support]
\ No newline at end of file
+//! [mpicxx_main version with args and thread support]
+//! [mpicxx_main version with startup report]
+#include <mpicxx/startup/mpicxx_main.hpp>
+
+int mpicxx_main(int argc, char** argv) {
+    // user code
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    // opt-in: write the durations of MPI_Init, mpicxx_main and MPI_Finalize as JSON to stderr (on rank 0 only)
+    mpicxx::startup_profiling::enable(std::cerr, mpicxx::startup_report_format::json);
+    return mpicxx::main(&mpicxx_main, argc, argv);
+}
+//! [mpicxx_main version with startup report]
+//! [mpicxx_main version with lazy initialization]
+#include <mpicxx/startup/mpicxx_main.hpp>
+
+int mpicxx_main(int argc, char** argv) {
+    if (argc > 1 && std::string_view(argv[1]) == "--help") {
+        // returns without ever initializing (or finalizing) the MPI environment
+        print_help();
+        return 0;
+    }
+
+    // the first mpicxx call which actually needs the MPI environment initializes it (exactly once)
+    mpicxx::single_spawner spawner("worker.out", 4);
+    spawner.spawn();
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    // opt-in: defer MPI_Init until it's actually needed
+    mpicxx::enable_lazy_init();
+    return mpicxx::main(&mpicxx_main, argc, argv);
+}
+//! [mpicxx_main version with lazy initialization]
\ No newline at end of file
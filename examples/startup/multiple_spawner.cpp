@@ -96,4 +96,44 @@ ms.set_spawn_info_at(1, info);
 
 // spawn new executables
 mpicxx::spawn_result_with_errcodes res = ms.spawn_with_errcodes();
-//! [spawn with error codes]
\ No newline at end of file
+//! [spawn with error codes]//! [freeze]
+// create multiple_spawner spawning exactly two new executables
+mpicxx::multiple_spawner ms({ { "a.out", 4 }, { "b.out", 2 } });
+
+// add command line arguments
+ms.add_argv_at(0, "--file", "foo", "--size", 42);
+
+// freeze the options once
+const mpicxx::prepared_spawn ps = ms.freeze();
+
+// repeatedly spawn the same process layout (without any conversion or memory allocation)
+for (int i = 0; i < 10; ++i) {
+    mpicxx::spawn_result res = ps.spawn();
+}
+//! [freeze]
+//! [spawn with payload]
+// parent processes: hand off a payload to all processes of the second executable
+std::vector<std::byte> config = read_config("config.bin");
+mpicxx::multiple_spawner ms({ "a.out", "b.out" }, { 2, 4 });
+ms.set_payload_at(1, config);
+mpicxx::spawn_result res = ms.spawn();
+
+// spawned processes (only b.out): receive the payload
+std::vector<std::byte> config = mpicxx::receive_payload();
+//! [spawn with payload]
+//! [spawn hierarchical]
+// all processes in MPI_COMM_WORLD: spawn 1024 processes, each of the first 16 processes spawns a chunk of 64 processes concurrently
+mpicxx::multiple_spawner ms({ "a.out", "b.out" }, { 512, 512 });
+mpicxx::spawn_result res = ms.spawn_hierarchical(16);
+// ... communicate via res.intercommunicator() ...
+MPI_Comm intercomm = res.intercommunicator();
+MPI_Comm_disconnect(&intercomm);
+
+// spawned processes: join the stitched communicators
+mpicxx::hierarchical_spawn_context context = mpicxx::join_hierarchical_spawn();
+int rank;
+MPI_Comm_rank(context.world, &rank);    // rank in [0, 1024)
+// ... communicate via context.parent and context.world ...
+MPI_Comm_disconnect(&context.parent);
+MPI_Comm_free(&context.world);
+//! [spawn hierarchical]
@@ -0,0 +1,32 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Examples for some functions of the @ref mpicxx::progress_engine implementation.
+ */
+
+//! [progress engine]
+// request a global progress engine pinned to the last core (started by mpicxx::init if MPI_THREAD_MULTIPLE is provided)
+mpicxx::progress_engine_config config;
+config.core = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+mpicxx::progress_engine::start_on_init(config);
+
+mpicxx::init(mpicxx::thread_support::multiple);
+{
+    // hand the nonblocking requests over to the progress engine
+    MPI_Request request;
+    MPI_Isend(send.data(), send.size(), MPI_DOUBLE, partner, 0, MPI_COMM_WORLD, &request);
+    std::future<MPI_Status> sent = mpicxx::progress_engine::global()->register_request(request);
+
+    // long running computation without any MPI call: the send still progresses in the background
+    compute();
+    sent.wait();
+
+    const mpicxx::progress_engine_statistics stats = mpicxx::progress_engine::global()->statistics();
+    std::cout << stats.completed_requests << " requests completed in the background" << std::endl;
+}
+// the global progress engine is stopped directly before MPI_Finalize
+mpicxx::finalize();
+//! [progress engine]
\ No newline at end of file
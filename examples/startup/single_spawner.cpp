@@ -36,4 +36,19 @@ ss.set_spawn_info(info);
 
 // spawn new executables
 mpicxx::spawn_result_with_errcodes res = ss.spawn_with_errcodes();
-//! [spawn with error codes]
\ No newline at end of file
+
+// inspect the failed spawns (one entry per distinct errcode)
+for (const mpicxx::errcode_summary& entry : res.error_summary()) {
+    fmt::print("{}x {} (first at index {})\n", entry.count, entry.message, entry.first_index);
+}
+//! [spawn with error codes]
+//! [spawn with payload]
+// parent processes: hand off a large configuration without converting it to command line arguments
+std::vector<std::byte> config = read_config("config.bin");
+mpicxx::single_spawner ss("a.out", 4);
+ss.set_payload(config);
+mpicxx::spawn_result res = ss.spawn();
+
+// spawned processes: receive the configuration
+std::vector<std::byte> config = mpicxx::receive_payload();
+//! [spawn with payload]
\ No newline at end of file
@@ -0,0 +1,42 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Examples for some functions of the @ref mpicxx::worker_pool implementation.
+ */
+
+//! [worker pool]
+// create multiple_spawner spawning four workers owned by this process only
+mpicxx::multiple_spawner ms({ { "worker.out", 4 } });
+ms.set_communicator(MPI_COMM_SELF);
+
+// spawn the workers exactly once
+mpicxx::worker_pool pool(ms);
+
+// dispatch multiple tasks (function id 0) to the warm workers
+const std::vector<std::byte> payload = serialize(42);
+for (int i = 0; i < 100; ++i) {
+    pool.submit(0, payload);
+}
+
+// grow the pool by two additional workers
+mpicxx::multiple_spawner more({ { "worker.out", 2 } });
+more.set_communicator(MPI_COMM_SELF);
+pool.grow(more);
+
+// wait for all outstanding tasks and shut the workers down
+std::vector<mpicxx::worker_task_result> results = pool.shutdown();
+//! [worker pool]
+//! [worker loop]
+// worker.out: process tasks until the pool shuts down
+mpicxx::worker_loop([](const mpicxx::worker_pool::function_id_type id, const std::span<const std::byte> payload) {
+    switch (id) {
+        case 0:
+            return serialize(compute(deserialize<int>(payload)));
+        default:
+            throw std::invalid_argument("Unknown function id!");
+    }
+});
+//! [worker loop]
@@ -13,6 +13,8 @@
 #ifndef MPICXX_CLOCK_HPP
 #define MPICXX_CLOCK_HPP
 
+#include <mpicxx/startup/init.hpp>
+
 #include <mpi.h>
 
 #include <chrono>
@@ -49,10 +51,15 @@ namespace mpicxx {
          * @return the elapsed wall-clock time
          * @nodiscard
          *
-         * @calls{ MPI_Wtime();    // exactly once }
+         * @calls{
+         * MPI_Wtime();    // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
          */
         [[nodiscard]]
-        static time_point now() noexcept {
+        static time_point now() {
+            mpicxx::ensure_initialized();
+
             return time_point(duration(MPI_Wtime()));
         }
 
@@ -62,10 +69,15 @@ namespace mpicxx {
          * @return the number of seconds between successive clock ticks
          * @nodiscard
          *
-         * @calls{ double MPI_Wtick();    // exactly once }
+         * @calls{
+         * double MPI_Wtick();    // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
          */
         [[nodiscard]]
-        static double resolution() noexcept {
+        static double resolution() {
+            mpicxx::ensure_initialized();
+
             return MPI_Wtick();
         }
 
@@ -82,10 +94,15 @@ namespace mpicxx {
          * @return `true` if the clocks are synchronized, otherwise `false`
          * @nodiscard
          *
-         * @calls{ int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag);    // exactly once }
+         * @calls{
+         * int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag);    // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
          */
         [[nodiscard]]
         static bool synchronized(MPI_Comm comm = MPI_COMM_WORLD) {
+            mpicxx::ensure_initialized();
+
             void* ptr;
             int flag;
             MPI_Comm_get_attr(comm, MPI_WTIME_IS_GLOBAL, &ptr, &flag);
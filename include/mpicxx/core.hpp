@@ -14,12 +14,24 @@
 // chrono
 #include <mpicxx/chrono/clock.hpp>
 // info
+#include <mpicxx/info/indexed_info.hpp>
 #include <mpicxx/info/info.hpp>
+#include <mpicxx/info/info_pool.hpp>
 #include <mpicxx/info/runtime_info.hpp>
 // startup
+#include <mpicxx/startup/communication_proxy.hpp>
+#include <mpicxx/startup/elastic_group.hpp>
+#include <mpicxx/startup/errcode.hpp>
+#include <mpicxx/startup/hierarchical_spawn.hpp>
+#include <mpicxx/startup/merged_communicator.hpp>
 #include <mpicxx/startup/mpicxx_main.hpp>
 #include <mpicxx/startup/multiple_spawner.hpp>
+#include <mpicxx/startup/progress_engine.hpp>
 #include <mpicxx/startup/single_spawner.hpp>
+#include <mpicxx/startup/spawn_payload.hpp>
+#include <mpicxx/startup/spawn_timings.hpp>
+#include <mpicxx/startup/startup_report.hpp>
+#include <mpicxx/startup/worker_pool.hpp>
 // version
 #include <mpicxx/version/version.hpp>
 
@@ -11,10 +11,16 @@
 #define MPICXX_CONVERSION_HPP
 
 #include <mpicxx/detail/concepts.hpp>
+#include <mpicxx/detail/expected.hpp>
 
+#include <charconv>
+#include <cstddef>
 #include <cstring>
+#include <span>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 
@@ -72,6 +78,18 @@ namespace mpicxx::detail {
      */
     template <typename T>
     concept has_ostringstream = requires (T t) { std::declval<std::ostringstream>() << t; };
+    /**
+     * @brief @concept{ @ref is_chars_convertible<T> }
+     *        Concept that describes a type that can be converted from and to a character sequence using
+     *        [`std::from_chars`](https://en.cppreference.com/w/cpp/utility/from_chars) and
+     *        [`std::to_chars`](https://en.cppreference.com/w/cpp/utility/to_chars), i.e. `bool`, enums and all arithmetic types except
+     *        character types.
+     * @tparam T the compared to type
+     */
+    template <typename T>
+    concept is_chars_convertible = std::is_same_v<T, bool> || std::is_enum_v<T>
+            || (std::is_arithmetic_v<T> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char>
+                && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>);
     ///@}
 
     /// @name conversion functions to std::string
@@ -121,6 +139,88 @@ namespace mpicxx::detail {
     }
     ///@}
 
+    /// @name conversion functions using std::to_chars and std::from_chars
+    ///@{
+    /**
+     * @brief The buffer size sufficient to hold the textual representation (including the null-terminator) of any type satisfying
+     *        @ref mpicxx::detail::is_chars_convertible.
+     */
+    inline constexpr std::size_t max_chars_size = 128;
+    /**
+     * @brief Converts @p val to its (locale independent) textual representation using
+     *        [`std::to_chars`](https://en.cppreference.com/w/cpp/utility/to_chars) and writes it null-terminated to @p buffer.
+     * @details `bool`s are converted to either `"true"` or `"false"`, enums are converted using their underlying type and floating point
+     *          types are converted using their shortest round-trip representation.
+     * @tparam T must meet the @ref mpicxx::detail::is_chars_convertible requirements
+     * @param[in] val the value to convert
+     * @param[out] buffer the buffer to write the textual representation to
+     * @return the number of written characters (excluding the null-terminator)
+     *
+     * @pre @p buffer **must** be at least @ref mpicxx::detail::max_chars_size large.
+     */
+    template <is_chars_convertible T>
+    std::size_t convert_to_chars(const T val, const std::span<char, max_chars_size> buffer) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            // convert the given boolean to its textual representation
+            const std::string_view str = val ? std::string_view("true") : std::string_view("false");
+            std::memcpy(buffer.data(), str.data(), str.size());
+            buffer[str.size()] = '\0';
+            return str.size();
+        } else if constexpr (std::is_enum_v<T>) {
+            // convert the underlying value of the enum
+            return convert_to_chars(static_cast<std::underlying_type_t<T>>(val), buffer);
+        } else {
+            // buffer is always large enough -> the conversion can't fail
+            const std::to_chars_result res = std::to_chars(buffer.data(), buffer.data() + buffer.size() - 1, val);
+            *res.ptr = '\0';
+            return static_cast<std::size_t>(res.ptr - buffer.data());
+        }
+    }
+    /**
+     * @brief Converts the textual representation @p str to a value of type @p T using
+     *        [`std::from_chars`](https://en.cppreference.com/w/cpp/utility/from_chars).
+     * @details `bool`s must be either `"true"` or `"false"`, enums are converted using their underlying type.
+     *          The **whole** @p str must be consumed by the conversion, i.e. leading or trailing characters are considered an error.
+     * @tparam T must meet the @ref mpicxx::detail::is_chars_convertible requirements
+     * @param[in] str the textual representation to convert
+     * @return the converted value or
+     *         [`std::errc::invalid_argument`](https://en.cppreference.com/w/cpp/error/errc) if @p str isn't a valid representation of @p T
+     *         respectively [`std::errc::result_out_of_range`](https://en.cppreference.com/w/cpp/error/errc) if the value doesn't fit into
+     *         @p T
+     * @nodiscard
+     */
+    template <is_chars_convertible T>
+    [[nodiscard]]
+    expected<T, std::errc> convert_from_chars(const std::string_view str) noexcept {
+        if constexpr (std::is_same_v<T, bool>) {
+            // convert the textual representation to a boolean
+            if (str == "true") {
+                return true;
+            } else if (str == "false") {
+                return false;
+            }
+            return unexpected(std::errc::invalid_argument);
+        } else if constexpr (std::is_enum_v<T>) {
+            // convert the underlying value of the enum
+            const expected<std::underlying_type_t<T>, std::errc> res = convert_from_chars<std::underlying_type_t<T>>(str);
+            if (!res.has_value()) {
+                return unexpected(res.error());
+            }
+            return static_cast<T>(res.value());
+        } else {
+            T val{};
+            const std::from_chars_result res = std::from_chars(str.data(), str.data() + str.size(), val);
+            if (res.ec != std::errc{}) {
+                return unexpected(res.ec);
+            } else if (res.ptr != str.data() + str.size()) {
+                // not the whole string could be converted
+                return unexpected(std::errc::invalid_argument);
+            }
+            return val;
+        }
+    }
+    ///@}
+
     /// @name conversion functions
     ///@{
     /**
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a minimal [`std::expected`](https://en.cppreference.com/w/cpp/utility/expected)-like class used to return either a value
+ *        or an error (instead of throwing an exception).
+ */
+
+#ifndef MPICXX_EXPECTED_HPP
+#define MPICXX_EXPECTED_HPP
+
+#include <mpicxx/detail/assert.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace mpicxx {
+
+    /**
+     * @brief Helper class to construct an @ref mpicxx::expected object holding an error.
+     * @tparam E the type of the error
+     */
+    template <typename E>
+    class unexpected {
+    public:
+        /**
+         * @brief Construct a new unexpected object holding the error @p err.
+         * @param[in] err the error
+         */
+        constexpr explicit unexpected(E err) noexcept(std::is_nothrow_move_constructible_v<E>) : err_(std::move(err)) { }
+
+        /**
+         * @brief Returns the held error.
+         * @return the error
+         * @nodiscard
+         */
+        [[nodiscard]]
+        constexpr const E& error() const noexcept { return err_; }
+
+    private:
+        E err_;
+    };
+
+
+    /**
+     * @brief A minimal implementation of C++23's [`std::expected`](https://en.cppreference.com/w/cpp/utility/expected) which either
+     *        holds an expected value of type @p T or an error of type @p E.
+     * @tparam T the type of the expected value
+     * @tparam E the type of the error
+     */
+    template <typename T, typename E>
+    class expected {
+    public:
+        /// The type of the expected value.
+        using value_type = T;
+        /// The type of the error.
+        using error_type = E;
+
+        /**
+         * @brief Construct a new expected object holding the value @p val.
+         * @param[in] val the expected value
+         */
+        constexpr expected(T val) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : data_(std::in_place_index<0>, std::move(val)) { }
+        /**
+         * @brief Construct a new expected object holding the error wrapped in @p err.
+         * @param[in] err the error
+         */
+        constexpr expected(unexpected<E> err) noexcept(std::is_nothrow_copy_constructible_v<E>)
+            : data_(std::in_place_index<1>, err.error()) { }
+
+        /**
+         * @brief Checks whether `*this` holds an expected value.
+         * @return `true` if `*this` holds a value, `false` if it holds an error
+         * @nodiscard
+         */
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept { return data_.index() == 0; }
+        /**
+         * @copydoc has_value()
+         */
+        [[nodiscard]]
+        constexpr explicit operator bool() const noexcept { return this->has_value(); }
+
+        /**
+         * @brief Returns the held expected value.
+         * @return the value
+         * @nodiscard
+         *
+         * @pre `*this` **must** hold a value.
+         *
+         * @assert_precondition{ If `*this` holds an error. }
+         */
+        [[nodiscard]]
+        constexpr const T& value() const {
+            MPICXX_ASSERT_PRECONDITION(this->has_value(), "Attempt to access the value of an expected object holding an error!");
+
+            return std::get<0>(data_);
+        }
+        /**
+         * @copydoc value()
+         */
+        [[nodiscard]]
+        constexpr const T& operator*() const { return this->value(); }
+        /**
+         * @brief Returns the held expected value or @p default_value if `*this` holds an error.
+         * @tparam U a type convertible to @p T
+         * @param[in] default_value the value to return if `*this` holds an error
+         * @return the value or @p default_value
+         * @nodiscard
+         */
+        template <typename U>
+        [[nodiscard]]
+        constexpr T value_or(U&& default_value) const {
+            return this->has_value() ? std::get<0>(data_) : static_cast<T>(std::forward<U>(default_value));
+        }
+        /**
+         * @brief Returns the held error.
+         * @return the error
+         * @nodiscard
+         *
+         * @pre `*this` **must** hold an error.
+         *
+         * @assert_precondition{ If `*this` holds a value. }
+         */
+        [[nodiscard]]
+        constexpr const E& error() const {
+            MPICXX_ASSERT_PRECONDITION(!this->has_value(), "Attempt to access the error of an expected object holding a value!");
+
+            return std::get<1>(data_);
+        }
+
+    private:
+        std::variant<T, E> data_;
+    };
+
+}
+
+#endif // MPICXX_EXPECTED_HPP
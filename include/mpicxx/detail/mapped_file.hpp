@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a read-only, memory-mapped view of a file.
+ * @details If [`mmap`](https://man7.org/linux/man-pages/man2/mmap.2.html) isn't available, the file content is read into an internal
+ *          buffer instead.
+ */
+
+#ifndef MPICXX_MAPPED_FILE_HPP
+#define MPICXX_MAPPED_FILE_HPP
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+// only used in this header (undefined at its end)
+#if __has_include(<sys/mman.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#define MPICXX_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#else
+#define MPICXX_HAS_MMAP 0
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace mpicxx::detail {
+
+    /**
+     * @brief RAII wrapper around a read-only, memory-mapped file.
+     */
+    class mapped_file {
+    public:
+        /**
+         * @brief Map the file @p path into memory.
+         * @param[in] path the file to map
+         *
+         * @throws std::system_error if the file can't be opened or mapped
+         */
+        explicit mapped_file(const std::filesystem::path& path) {
+#if MPICXX_HAS_MMAP
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1) {
+                throw std::system_error(errno, std::generic_category(), fmt::format("Can't open file '{}'", path.string()));
+            }
+            struct stat st;
+            if (::fstat(fd, &st) == -1) {
+                const int err = errno;
+                ::close(fd);
+                throw std::system_error(err, std::generic_category(), fmt::format("Can't stat file '{}'", path.string()));
+            }
+            size_ = static_cast<std::size_t>(st.st_size);
+            // mapping an empty file isn't allowed
+            if (size_ > 0) {
+                void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) {
+                    const int err = errno;
+                    ::close(fd);
+                    throw std::system_error(err, std::generic_category(), fmt::format("Can't map file '{}'", path.string()));
+                }
+                data_ = static_cast<const char*>(data);
+            }
+            // the mapping stays valid after closing the file descriptor
+            ::close(fd);
+#else
+            std::ifstream in(path, std::ios::binary);
+            if (!in) {
+                throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory),
+                        fmt::format("Can't open file '{}'", path.string()));
+            }
+            buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+#endif
+        }
+        /**
+         * @brief Deleted copy constructor.
+         */
+        mapped_file(const mapped_file&) = delete;
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        mapped_file& operator=(const mapped_file&) = delete;
+        /**
+         * @brief Unmap the file.
+         */
+        ~mapped_file() {
+#if MPICXX_HAS_MMAP
+            if (data_ != nullptr) {
+                ::munmap(const_cast<char*>(data_), size_);
+            }
+#endif
+        }
+
+        /**
+         * @brief Returns a view of the whole file content.
+         * @return the file content
+         * @nodiscard
+         */
+        [[nodiscard]]
+        std::string_view view() const noexcept { return std::string_view(data_, size_); }
+
+    private:
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+#if !MPICXX_HAS_MMAP
+        std::string buffer_;
+#endif
+    };
+
+}
+
+#undef MPICXX_HAS_MMAP
+
+#endif // MPICXX_MAPPED_FILE_HPP
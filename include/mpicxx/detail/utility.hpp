@@ -10,7 +10,9 @@
 #ifndef MPICXX_UTILITY_HPP
 #define MPICXX_UTILITY_HPP
 
+#include <cstdint>
 #include <functional>
+#include <string_view>
 #include <type_traits>
 
 namespace mpicxx::detail {
@@ -114,6 +116,42 @@ namespace mpicxx::detail {
     constexpr bool all_same(Op pred, const T& t) noexcept { return true; }
     ///@}
 
+    /// @name hashing utility functions
+    ///@{
+    /**
+     * @brief Calculates the hash of a single [key, value]-pair.
+     * @details Uses [FNV-1a](https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function) over @p key, a null-terminator
+     *          and @p value followed by the [SplitMix64](https://prng.di.unimi.it/splitmix64.c) finalizer. The finalizer
+     *          spreads the bits, so that the **sum** of multiple pair hashes can be used as an order-independent hash.
+     * @param[in] key the key of the [key, value]-pair
+     * @param[in] value the value of the [key, value]-pair
+     * @return the 64-bit hash value
+     * @nodiscard
+     */
+    [[nodiscard]]
+    constexpr std::uint64_t hash_pair(const std::string_view key, const std::string_view value) noexcept {
+        std::uint64_t hash = 14695981039346656037ull;
+        const auto fnv1a = [&hash](const std::string_view str) {
+            for (const char c : str) {
+                hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+                hash *= 1099511628211ull;
+            }
+        };
+        fnv1a(key);
+        // separate key and value, such that e.g. ["ab", "c"] and ["a", "bc"] result in different hashes
+        hash *= 1099511628211ull;
+        fnv1a(value);
+
+        // SplitMix64 finalizer
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ull;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebull;
+        hash ^= hash >> 31;
+        return hash;
+    }
+    ///@}
+
 }
 
 #endif // MPICXX_UTILITY_HPP
\ No newline at end of file
@@ -0,0 +1,529 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements an @ref mpicxx::info wrapper which keeps a local hash index of all keys to provide constant time lookups.
+ * @details The lookup functions of @ref mpicxx::info (e.g. @ref mpicxx::info::find(const std::string_view)) have to linearly search
+ *          through all keys via [*MPI_Info_get_nthkey*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm), resulting in
+ *          \f$O(n)\f$ *MPI* calls per lookup. The @ref mpicxx::indexed_info class trades some memory for a local
+ *          [`std::unordered_map`](https://en.cppreference.com/w/cpp/container/unordered_map) mapping each key to its position, such that
+ *          a lookup only costs a single hash probe.
+ */
+
+#ifndef MPICXX_INDEXED_INFO_HPP
+#define MPICXX_INDEXED_INFO_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/info/info.hpp>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace mpicxx {
+
+    namespace detail {
+
+        /**
+         * @brief Transparent string hash enabling heterogeneous lookups (e.g. using a
+         *        [`std::string_view`](https://en.cppreference.com/w/cpp/string/basic_string_view)) in a
+         *        [`std::unordered_map`](https://en.cppreference.com/w/cpp/container/unordered_map) with
+         *        [`std::string`](https://en.cppreference.com/w/cpp/string/basic_string) keys.
+         */
+        struct string_hash {
+            /// Marks the hash as transparent.
+            using is_transparent = void;
+            /**
+             * @brief Calculates the hash of @p str.
+             * @param[in] str the string to hash
+             * @return the hash value
+             * @nodiscard
+             */
+            [[nodiscard]]
+            std::size_t operator()(const std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+        };
+
+    }
+
+    /**
+     * @nosubgrouping
+     * @brief Opt-in wrapper around an @ref mpicxx::info object keeping a [key → position] hash index in sync with the underlying
+     *        [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object.
+     * @details All lookups (@ref find(const std::string_view), @ref contains(const std::string_view) const, ...) cost a single hash probe
+     *          instead of a linear search through all keys. In exchange, the index has to be build once (\f$O(n)\f$ *MPI* calls) and
+     *          consumes additional memory. \n
+     *          For small info objects or info objects which are only queried a few times, the plain @ref mpicxx::info class may be the
+     *          better choice (see `benchmarks/info/indexed_info.cpp` for the crossover point).
+     *
+     *    Example usage:
+     *          @snippet examples/info/indexed_info.cpp mwe
+     * @attention The [MPI standard 3.1](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report.pdf) only guarantees that the number of a
+     *            given key does not change **as long as** no call to
+     *            [*MPI_Info_set*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) or
+     *            [*MPI_Info_delete*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) is made.
+     *            Therefore, each insertion validates the position of the newly inserted key (rebuilding the index if necessary) and an
+     *            erasure assumes, as done by all major MPI implementations, that the keys following the erased one move one position
+     *            forward.
+     * @attention Modifying the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object directly
+     *            (i.e. bypassing the @ref mpicxx::indexed_info interface) invalidates the index. Call @ref reindex() afterwards.
+     */
+    class indexed_info {
+        // the index type: [key -> position]-map allowing heterogeneous lookups
+        using index_type = std::unordered_map<std::string, std::size_t, detail::string_hash, std::equal_to<>>;
+    public:
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                member types                                                //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// The type of a key.
+        using key_type = info::key_type;
+        /// The type of a value associated with a key.
+        using mapped_type = info::mapped_type;
+        /// The type of a [key, value]-pair.
+        using value_type = info::value_type;
+        /// Unsigned integer type.
+        using size_type = info::size_type;
+        /// Signed integer type.
+        using difference_type = info::difference_type;
+        /// Alias for the iterator type of the underlying @ref mpicxx::info object.
+        using iterator = info::iterator;
+        /// Alias for the const_iterator type of the underlying @ref mpicxx::info object.
+        using const_iterator = info::const_iterator;
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                        constructors and destructor                                         //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name constructors and destructor
+        ///@{
+        /**
+         * @brief Constructs an empty indexed info object.
+         *
+         * @calls{ int MPI_Info_create(MPI_Info *info);    // exactly once }
+         */
+        indexed_info() = default;
+        /**
+         * @brief Constructs an indexed info object by taking over @p other and building the hash index.
+         * @param[in] other the info object to index
+         *
+         * @pre @p other **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p other refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);           // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);    // exactly 'other.size()' times
+         * }
+         */
+        explicit indexed_info(info other) : info_(std::move(other)) {
+            MPICXX_ASSERT_PRECONDITION(info_.get() != MPI_INFO_NULL, "Attempt to index an info object referring to 'MPI_INFO_NULL'!");
+
+            this->reindex();
+        }
+        /**
+         * @brief Constructs the indexed info object with the contents of the
+         *        [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) @p init.
+         * @details If multiple [key, value]-pairs in the range share the same key, the **last** occurrence determines the final value.
+         * @param[in] init [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) to initialize the
+         *                 [key, value]-pairs of the indexed info object with
+         *
+         * @calls{
+         * int MPI_Info_create(MPI_Info *info);                                    // exactly once
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // exactly 'init.size()' times
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);                      // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);               // exactly 'this->size()' times
+         * }
+         */
+        indexed_info(std::initializer_list<value_type> init) : info_(init) {
+            this->reindex();
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                  iterators                                                 //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name iterators
+        ///@{
+        /**
+         * @brief Returns an iterator to the first [key, value]-pair of the underlying info object.
+         * @return iterator to the first [key, value]-pair
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const_iterator begin() const { return const_iterator(info_.get(), 0); }
+        /**
+         * @brief Returns an iterator to the element following the last [key, value]-pair of the underlying info object.
+         * @details Doesn't call [*MPI_Info_get_nkeys*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @return iterator to the element following the last [key, value]-pair
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const_iterator end() const { return const_iterator(info_.get(), static_cast<difference_type>(index_.size())); }
+        /**
+         * @copydoc begin() const
+         */
+        [[nodiscard]]
+        const_iterator cbegin() const { return this->begin(); }
+        /**
+         * @copydoc end() const
+         */
+        [[nodiscard]]
+        const_iterator cend() const { return this->end(); }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                  capacity                                                  //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name capacity
+        ///@{
+        /**
+         * @brief Checks if the indexed info object has no [key, value]-pairs.
+         * @details Doesn't call any *MPI* function.
+         * @return `true` if the indexed info object is empty, `false` otherwise
+         * @nodiscard
+         */
+        [[nodiscard]]
+        bool empty() const noexcept { return index_.empty(); }
+        /**
+         * @brief Returns the number of [key, value]-pairs in the indexed info object.
+         * @details Doesn't call any *MPI* function.
+         * @return the number of [key, value]-pairs
+         * @nodiscard
+         */
+        [[nodiscard]]
+        size_type size() const noexcept { return index_.size(); }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                  modifiers                                                 //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name modifiers
+        ///@{
+        /**
+         * @brief Access the value associated with the given @p key including bounds checks.
+         * @param[in] key the @p key of the [key, value]-pair to find
+         * @return the value associated with @p key
+         *
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p key exceeds its size limit. }
+         *
+         * @throws std::out_of_range if the indexed info object does not have a [key, value]-pair with the specified @p key
+         *
+         * @calls{
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly once
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // at most once
+         * }
+         */
+        [[nodiscard]]
+        std::string at(const std::string_view key) const {
+            return info_.at(key);
+        }
+
+        /**
+         * @brief Insert the given [key, value]-pair if the indexed info object doesn't already contain a [key, value]-pair with an
+         *        equivalent key.
+         * @param[in] key @p key of the [**key**, value]-pair to insert
+         * @param[in] value @p value of the [key, **value**]-pair to insert
+         * @return a pair consisting of an iterator to the inserted [key, value]-pair (or the one that prevented the insertion) and a `bool`
+         *         denoting whether the insertion took place
+         *
+         * @pre **Both** @p key **and** @p value **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The @p value's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_VAL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p key or @p value exceed their size limit. }
+         * @assert_sanity{ If the hash index is out of sync with the underlying info object. }
+         *
+         * @calls{
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // at most once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);               // at most once (if the new key isn't appended)
+         * }
+         */
+        std::pair<iterator, bool> insert(const std::string_view key, const std::string_view value) {
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
+                    "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(value, MPI_MAX_INFO_VAL),
+                    "Illegal info value: 0 < {} < {} (MPI_MAX_INFO_VAL)", value.size(), MPI_MAX_INFO_VAL);
+
+            if (const auto it = index_.find(key); it != index_.end()) {
+                // key already exists -> no insertion
+                return std::make_pair(iterator(info_.get(), static_cast<difference_type>(it->second)), false);
+            }
+            MPI_Info_set(info_.get(), key.data(), value.data());
+            return std::make_pair(iterator(info_.get(), static_cast<difference_type>(this->index_new_key(key))), true);
+        }
+        /**
+         * @brief Insert or assign the given [key, value]-pair to the indexed info object.
+         * @param[in] key @p key of the [**key**, value]-pair to insert
+         * @param[in] value @p value of the [key, **value**]-pair to insert
+         * @return a pair consisting of an iterator to the inserted or assigned [key, value]-pair and a `bool`
+         *         denoting whether the insertion (`true`) or the assignment (`false`) took place
+         *
+         * @pre **Both** @p key **and** @p value **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The @p value's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_VAL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p key or @p value exceed their size limit. }
+         * @assert_sanity{ If the hash index is out of sync with the underlying info object. }
+         *
+         * @calls{
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);               // at most once (if the new key isn't appended)
+         * }
+         */
+        std::pair<iterator, bool> insert_or_assign(const std::string_view key, const std::string_view value) {
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
+                    "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(value, MPI_MAX_INFO_VAL),
+                    "Illegal info value: 0 < {} < {} (MPI_MAX_INFO_VAL)", value.size(), MPI_MAX_INFO_VAL);
+
+            MPI_Info_set(info_.get(), key.data(), value.data());
+            if (const auto it = index_.find(key); it != index_.end()) {
+                // key already exists -> assignment took place
+                MPICXX_ASSERT_SANITY(this->index_in_sync(), "The hash index is out of sync with the underlying info object!");
+                return std::make_pair(iterator(info_.get(), static_cast<difference_type>(it->second)), false);
+            }
+            return std::make_pair(iterator(info_.get(), static_cast<difference_type>(this->index_new_key(key))), true);
+        }
+
+        /**
+         * @brief Removes the [key, value]-pair (if one exists) with the key equivalent to @p key.
+         * @details Returns either 1 (key found and removed) or 0 (no such key found and therefore nothing removed).
+         *          Updating the hash index costs \f$O(n)\f$ but doesn't call any additional *MPI* function.
+         * @param[in] key key value of the [key, value]-pair to remove
+         * @return number of elements removed (either 0 or 1)
+         *
+         * @pre @p key **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p key exceeds its size limit. }
+         * @assert_sanity{ If the hash index is out of sync with the underlying info object. }
+         *
+         * @calls{ int MPI_Info_delete(MPI_Info info, const char *key);    // at most once }
+         */
+        size_type erase(const std::string_view key) {
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
+                    "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
+
+            const auto it = index_.find(key);
+            if (it == index_.end()) {
+                return 0;
+            }
+            MPI_Info_delete(info_.get(), key.data());
+            // all keys following the erased key move one position forward
+            const std::size_t pos = it->second;
+            index_.erase(it);
+            for (auto& [_, p] : index_) {
+                if (p > pos) {
+                    --p;
+                }
+            }
+
+            MPICXX_ASSERT_SANITY(this->index_in_sync(), "The hash index is out of sync with the underlying info object!");
+            return 1;
+        }
+
+        /**
+         * @brief Erase all [key, value]-pairs from the indexed info object.
+         *
+         * @post The indexed info object is empty, i.e. `this->size() == 0` respectively `this->empty() == true`.
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);           // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);    // exactly 'this->size()' times
+         * int MPI_Info_delete(MPI_Info info, const char *key);         // exactly 'this->size()' times
+         * }
+         */
+        void clear() {
+            info_.clear();
+            index_.clear();
+        }
+
+        /**
+         * @brief Rebuilds the hash index from scratch.
+         * @details Must be called if the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object
+         *          has been changed without using the @ref mpicxx::indexed_info interface.
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);           // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);    // exactly 'this->size()' times
+         * }
+         */
+        void reindex() {
+            const size_type size = info_.size();
+            index_.clear();
+            index_.reserve(size);
+            char key[MPI_MAX_INFO_KEY];
+            for (size_type i = 0; i < size; ++i) {
+                MPI_Info_get_nthkey(info_.get(), static_cast<int>(i), key);
+                index_.emplace(key, i);
+            }
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                   lookup                                                   //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name lookup
+        ///@{
+        /**
+         * @brief Returns the number of [key, value]-pairs with key equivalent to @p key (either 0 or 1).
+         * @details Doesn't call any *MPI* function.
+         * @param[in] key @p key value of the [key, value]-pairs to count
+         * @return number of [key, value]-pairs with key equivalent to @p key, which is either 0 or 1
+         * @nodiscard
+         */
+        [[nodiscard]]
+        size_type count(const std::string_view key) const {
+            return static_cast<size_type>(this->contains(key));
+        }
+        /**
+         * @brief Finds a [key, value]-pair with key equivalent to @p key.
+         * @details If the key is found, returns an iterator pointing to the corresponding [key, value]-pair,
+         *          otherwise the past-the-end iterator is returned (see @ref end()). Doesn't call any *MPI* function.
+         * @param[in] key @p key value of the [key, value]-pair to search for
+         * @return iterator to a [key, value]-pair with key equivalent to @p key or the past-the-end iterator if no such key is found
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const_iterator find(const std::string_view key) const {
+            return const_iterator(info_.get(), static_cast<difference_type>(this->find_pos(key)));
+        }
+        /**
+         * @brief Checks if there is a [key, value]-pair with key equivalent to @p key.
+         * @details Doesn't call any *MPI* function.
+         * @param[in] key @p key value of the [key, value]-pair to search for
+         * @return `true` if there is such a [key, value]-pair, otherwise `false`
+         * @nodiscard
+         */
+        [[nodiscard]]
+        bool contains(const std::string_view key) const {
+            return index_.find(key) != index_.end();
+        }
+        /**
+         * @brief Returns a range containing all [key, value]-pairs with key equivalent to @p key.
+         * @details Since info objects don't allow duplicated keys the range contains either 0 or 1 [key, value]-pairs.
+         *          Doesn't call any *MPI* function.
+         * @param[in] key @p key value of the [key, value]-pair to search for
+         * @return [`std::pair`](https://en.cppreference.com/w/cpp/utility/pair) containing a pair of iterators defining the wanted range
+         * @nodiscard
+         */
+        [[nodiscard]]
+        std::pair<const_iterator, const_iterator> equal_range(const std::string_view key) const {
+            const size_type pos = this->find_pos(key);
+            const size_type last = pos == index_.size() ? pos : pos + 1;
+            return std::make_pair(const_iterator(info_.get(), static_cast<difference_type>(pos)),
+                                  const_iterator(info_.get(), static_cast<difference_type>(last)));
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                   getter                                                   //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /**
+         * @brief Get the underlying @ref mpicxx::info object.
+         * @return the indexed info object
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const info& base() const noexcept { return info_; }
+        /**
+         * @brief Get the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object.
+         * @return the [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const MPI_Info& get() const noexcept { return info_.get(); }
+
+
+    private:
+        /*
+         * @brief Finds the position of the given @p key using the hash index.
+         * @param[in] key the @p key to find
+         * @return the position of the @p key or `this->size()` if the @p key does not exist in this indexed info object
+         */
+        size_type find_pos(const std::string_view key) const {
+            const auto it = index_.find(key);
+            return it != index_.end() ? it->second : index_.size();
+        }
+        /*
+         * @brief Adds the newly inserted @p key to the hash index.
+         * @details All major MPI implementations append new keys. If that's not the case, the whole hash index is rebuild.
+         * @param[in] key the newly inserted key
+         * @return the position of @p key
+         *
+         * @calls{ int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);    // at least once }
+         */
+        size_type index_new_key(const std::string_view key) {
+            const size_type pos = index_.size();
+            char info_key[MPI_MAX_INFO_KEY];
+            MPI_Info_get_nthkey(info_.get(), static_cast<int>(pos), info_key);
+            if (key.compare(info_key) == 0) {
+                // key has been appended
+                index_.emplace(key, pos);
+            } else {
+                // unexpected ordering -> rebuild the whole hash index
+                this->reindex();
+            }
+
+            MPICXX_ASSERT_SANITY(this->index_in_sync(), "The hash index is out of sync with the underlying info object!");
+            return this->find_pos(key);
+        }
+
+#if MPICXX_ASSERTION_LEVEL > 0
+        /*
+         * @brief Check whether @p val has a legal size.
+         * @details @p val has a legal size if it is greater than zero and less then @p max_size.
+         * @param[in] val the string to check
+         * @param[in] max_size the maximum legal size
+         * @return `true` if the size is legal, otherwise `false`
+         */
+        bool legal_string_size(const std::string_view val, const int max_size) const {
+            return 0 < val.size() && val.size() < static_cast<std::size_t>(max_size);
+        }
+        /*
+         * @brief Checks whether the hash index matches the underlying info object.
+         * @return `true` if all keys are stored at their indexed positions, otherwise `false`
+         */
+        bool index_in_sync() const {
+            if (info_.size() != index_.size()) {
+                return false;
+            }
+            char key[MPI_MAX_INFO_KEY];
+            for (const auto& [k, pos] : index_) {
+                MPI_Info_get_nthkey(info_.get(), static_cast<int>(pos), key);
+                if (k != key) {
+                    return false;
+                }
+            }
+            return true;
+        }
+#endif
+
+        info info_;
+        index_type index_;
+    };
+
+}
+
+#endif // MPICXX_INDEXED_INFO_HPP
@@ -16,26 +16,50 @@
 #include <mpicxx/detail/assert.hpp>
 #include <mpicxx/detail/concepts.hpp>
 #include <mpicxx/detail/conversion.hpp>
+#include <mpicxx/detail/expected.hpp>
+#include <mpicxx/detail/mapped_file.hpp>
+#include <mpicxx/detail/utility.hpp>
+#include <mpicxx/info/info_pool.hpp>
 
 #include <fmt/format.h>
 #include <mpi.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <exception>
+#include <filesystem>
 #include <functional>
 #include <initializer_list>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <stdexcept>
+#include <system_error>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace mpicxx {
+
+    /**
+     * @brief Enum class for the possible errors returned by @ref mpicxx::info::get(const std::string_view) const.
+     */
+    enum class info_errc {
+        /** the requested key doesn't exist */
+        key_not_found,
+        /** the value isn't a valid textual representation of the requested type */
+        invalid_argument,
+        /** the value is out of range of the requested type */
+        result_out_of_range
+    };
+
     /**
      * @nosubgrouping
      * @brief This class is a wrapper to the [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object providing
@@ -967,6 +991,209 @@ namespace mpicxx {
         };
 
 
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                               snapshot class                                               //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /**
+         * @nosubgrouping
+         * @brief A read-only, random access range over a copy of all [key, value]-pairs of an info object, returned by
+         *        @ref mpicxx::info::snapshot() const.
+         * @details All [key, value]-pairs are copied **once** (in a single pass over the info object) into an arena allocation: the arena
+         *          starts with the array of [`std::string_view`](https://en.cppreference.com/w/cpp/string/basic_string_view) pairs followed
+         *          by the null-terminated key and value characters the pairs refer to. The arena grows geometrically if the initially
+         *          reserved characters don't suffice.
+         *
+         *          The snapshot doesn't observe any later changes of the info object it was created from. It is move-only, moving doesn't
+         *          invalidate any [`std::string_view`](https://en.cppreference.com/w/cpp/string/basic_string_view) or iterator.
+         */
+        class snapshot_view {
+        public:
+            // ------------------------------------------------------------------------------------------------------ //
+            //                                              member types                                              //
+            // ------------------------------------------------------------------------------------------------------ //
+            /// The type of a [key, value]-pair referring into the arena.
+            using value_type = std::pair<std::string_view, std::string_view>;
+            /// Unsigned integer type.
+            using size_type = std::size_t;
+            /// Signed integer type.
+            using difference_type = std::ptrdiff_t;
+            /// The type of value_type used as a const reference.
+            using const_reference = const value_type&;
+            /// The type of a random access iterator (a pointer into the arena).
+            using const_iterator = const value_type*;
+            /// The type of a random access iterator (same as @ref const_iterator since a snapshot is read-only).
+            using iterator = const_iterator;
+
+
+            // ------------------------------------------------------------------------------------------------------ //
+            //                                              constructor                                               //
+            // ------------------------------------------------------------------------------------------------------ //
+            /**
+             * @brief Copy all [key, value]-pairs of @p info into a single arena allocation.
+             * @param[in] info the copied [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object
+             *
+             * @pre @p info **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+             *
+             * @assert_sanity{ If @p info refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+             *
+             * @calls{
+             * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);                                         // exactly once
+             * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);                                  // exactly 'this->size()' times
+             * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly 'this->size()' times
+             * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // exactly 'this->size()' times
+             * }
+             */
+            explicit snapshot_view(const MPI_Info info) {
+                MPICXX_ASSERT_SANITY(info != MPI_INFO_NULL, "Attempt to create a snapshot of an info object referring to 'MPI_INFO_NULL'!");
+
+                int nkeys;
+                MPI_Info_get_nkeys(info, &nkeys);
+                size_ = static_cast<size_type>(nkeys);
+
+                // allocate the arena: [key, value]-pairs followed by the characters (grown on demand)
+                const size_type pairs_bytes = size_ * sizeof(value_type);
+                size_type capacity = pairs_bytes + size_ * initial_chars_per_pair;
+                arena_ = std::make_unique_for_overwrite<std::byte[]>(capacity);
+                size_type used = pairs_bytes;
+
+                // single pass: copy all null-terminated keys and values into the arena
+                // (the key is queried into the local buffer since MPI_Info_get_nthkey may write up to MPI_MAX_INFO_KEY characters)
+                char key[MPI_MAX_INFO_KEY];
+                for (int i = 0; i < nkeys; ++i) {
+                    MPI_Info_get_nthkey(info, i, key);
+                    const size_type key_size = std::strlen(key) + 1;
+                    int valuelen, flag;
+                    MPI_Info_get_valuelen(info, key, &valuelen, &flag);
+                    const size_type needed = key_size + static_cast<size_type>(valuelen) + 1;
+                    if (used + needed > capacity) {
+                        capacity = std::max(2 * capacity, used + needed);
+                        std::unique_ptr<std::byte[]> grown = std::make_unique_for_overwrite<std::byte[]>(capacity);
+                        std::memcpy(grown.get() + pairs_bytes, arena_.get() + pairs_bytes, used - pairs_bytes);
+                        arena_ = std::move(grown);
+                    }
+                    char* ptr = reinterpret_cast<char*>(arena_.get() + used);
+                    std::memcpy(ptr, key, key_size);
+                    ptr += key_size;
+                    MPI_Info_get(info, key, valuelen, ptr, &flag);
+                    ptr[valuelen] = '\0';
+                    used += needed;
+                }
+
+                // the arena doesn't move anymore: create the [key, value]-pairs referring to the characters
+                value_type* pairs = reinterpret_cast<value_type*>(arena_.get());
+                const char* ptr = reinterpret_cast<const char*>(arena_.get() + pairs_bytes);
+                for (size_type i = 0; i < size_; ++i) {
+                    const std::string_view key_view(ptr);
+                    ptr += key_view.size() + 1;
+                    const std::string_view value_view(ptr);
+                    ptr += value_view.size() + 1;
+                    std::construct_at(pairs + i, key_view, value_view);
+                }
+            }
+
+
+            // ------------------------------------------------------------------------------------------------------ //
+            //                                               iterators                                                //
+            // ------------------------------------------------------------------------------------------------------ //
+            /// @name iterators
+            ///@{
+            /**
+             * @brief Returns an iterator to the first [key, value]-pair of the snapshot.
+             * @return iterator to the first [key, value]-pair
+             * @nodiscard
+             */
+            [[nodiscard]]
+            const_iterator begin() const noexcept { return this->data(); }
+            /**
+             * @brief Returns an iterator to the element following the last [key, value]-pair of the snapshot.
+             * @return iterator to the element following the last [key, value]-pair
+             * @nodiscard
+             */
+            [[nodiscard]]
+            const_iterator end() const noexcept { return this->data() + size_; }
+            /**
+             * @copydoc begin()
+             */
+            [[nodiscard]]
+            const_iterator cbegin() const noexcept { return this->begin(); }
+            /**
+             * @copydoc end()
+             */
+            [[nodiscard]]
+            const_iterator cend() const noexcept { return this->end(); }
+            ///@}
+
+
+            // ------------------------------------------------------------------------------------------------------ //
+            //                                           capacity and access                                          //
+            // ------------------------------------------------------------------------------------------------------ //
+            /// @name capacity and access
+            ///@{
+            /**
+             * @brief Checks if the snapshot has no [key, value]-pairs.
+             * @return `true` if the snapshot is empty, `false` otherwise
+             * @nodiscard
+             */
+            [[nodiscard]]
+            bool empty() const noexcept { return size_ == 0; }
+            /**
+             * @brief Returns the number of [key, value]-pairs in the snapshot.
+             * @return the number of [key, value]-pairs
+             * @nodiscard
+             */
+            [[nodiscard]]
+            size_type size() const noexcept { return size_; }
+            /**
+             * @brief Returns the [key, value]-pair at position @p n.
+             * @details Both [`std::string_view`](https://en.cppreference.com/w/cpp/string/basic_string_view) are null-terminated.
+             * @param[in] n the requested position
+             * @return the [key, value]-pair at position @p n
+             * @nodiscard
+             *
+             * @pre @p n **must** be less than `this->size()`.
+             *
+             * @assert_precondition{ If @p n is out of bounds. }
+             */
+            [[nodiscard]]
+            const_reference operator[](const size_type n) const {
+                MPICXX_ASSERT_PRECONDITION(n < size_, "Requested an illegal snapshot position: {} < {} (size)", n, size_);
+
+                return this->data()[n];
+            }
+            /**
+             * @brief Returns a pointer to the first [key, value]-pair in the arena.
+             * @return pointer to the first [key, value]-pair
+             * @nodiscard
+             */
+            [[nodiscard]]
+            const value_type* data() const noexcept { return reinterpret_cast<const value_type*>(arena_.get()); }
+            /**
+             * @brief Returns the order-independent 64-bit hash of all [key, value]-pairs in the snapshot.
+             * @details Equal to the @ref mpicxx::info::fingerprint() const of the info object at the time the snapshot was taken.
+             * @return the fingerprint
+             * @nodiscard
+             */
+            [[nodiscard]]
+            std::uint64_t fingerprint() const noexcept {
+                std::uint64_t hash = 0;
+                for (const auto& [key, value] : *this) {
+                    hash += detail::hash_pair(key, value);
+                }
+                return hash;
+            }
+            ///@}
+
+        private:
+            /*
+             * @brief The number of characters initially reserved per [key, value]-pair (the arena grows if more are needed).
+             */
+            static constexpr size_type initial_chars_per_pair = 64;
+
+            std::unique_ptr<std::byte[]> arena_;
+            size_type size_ = 0;
+        };
+
+
     public:
         // ---------------------------------------------------------------------------------------------------------- //
         //                                                member types                                                //
@@ -997,6 +1224,8 @@ namespace mpicxx {
         using reverse_iterator = std::reverse_iterator<iterator>;
         /// Alias for a const_reverse_iterator using [`std::reverse_iterator`](https://en.cppreference.com/w/cpp/iterator/reverse_iterator).
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        /// Alias for the read-only snapshot range returned by @ref snapshot() const.
+        using snapshot_type = snapshot_view;
 
 
         // ---------------------------------------------------------------------------------------------------------- //
@@ -1046,11 +1275,14 @@ namespace mpicxx {
          *
          * @post The newly constructed info object is in a valid state.
          *
-         * @calls{ int MPI_Info_create(MPI_Info *info);    // exactly once }
+         * @calls{
+         * int MPI_Info_create(MPI_Info *info);    // at most once (not called if the handle is served from the @ref mpicxx::info_pool)
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
          */
         info() : is_freeable_(true) {
             // initialize an empty info object
-            MPI_Info_create(&info_);
+            info_ = info_pool::acquire();
         }
         /**
          * @brief Copy constructor. Constructs the info object with a copy of the contents of @p other.
@@ -1060,19 +1292,15 @@ namespace mpicxx {
          * @post The newly constructed info object is in a valid state iff @p other is in a valid state.
          * @attention Every copied info object (except if `other.get() == MPI_INFO_NULL`) is marked **freeable** independent of the
          *            **freeable** state of make the copied-from info object.
+         * @attention If @p other has the copy-on-write mode enabled (see @ref mpicxx::info::set_copy_on_write(const bool)) and is
+         *            **freeable**, no [*MPI_Info_dup*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) is called.
+         *            Instead, both info objects share the same underlying
+         *            [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object until one of them is modified.
          *
          * @calls{ int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most once }
          */
-        info(const info& other) {
-            if (other.info_ == MPI_INFO_NULL) {
-                // copy an info object which refers to MPI_INFO_NULL
-                info_ = MPI_INFO_NULL;
-                is_freeable_ = other.is_freeable_;
-            } else {
-                // copy normal info object
-                MPI_Info_dup(other.info_, &info_);
-                is_freeable_ = true;
-            }
+        info(const info& other) : copy_on_write_(other.copy_on_write_) {
+            this->copy_from(other);
         }
         /**
          * @brief Move constructor. Constructs the info object with the contents of @p other using move semantics.
@@ -1095,7 +1323,10 @@ namespace mpicxx {
          *              @ref mpicxx::info::max_value_size()
          *            - all getters: @ref mpicxx::info::get(), @ref mpicxx::info::get() const and @ref mpicxx::info::freeable() const
          */
-        info(info&& other) noexcept : info_(std::move(other.info_)), is_freeable_(std::move(other.is_freeable_)) {
+        info(info&& other) noexcept
+            : info_(std::move(other.info_)), is_freeable_(std::move(other.is_freeable_)),
+              copy_on_write_(other.copy_on_write_), shared_(std::move(other.shared_))
+        {
             // set other to the moved-from state (referring to MPI_INFO_NULL)
             other.info_ = MPI_INFO_NULL;
             other.is_freeable_ = false;
@@ -1238,16 +1469,11 @@ namespace mpicxx {
          *                       [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) or
          *                       [*MPI_INFO_ENV*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
          *
-         * @calls{ int MPI_Info_free(MPI_info *info);    // at most once }
+         * @calls{ int MPI_Info_free(MPI_info *info);    // at most once (not called if other info objects share the same MPI_Info object) }
          */
         ~info() {
             // destroy info object if marked as freeable
-            if (is_freeable_) {
-                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_NULL, "Attempt to free a 'MPI_INFO_NULL' object!");
-                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_ENV, "Attempt to free a 'MPI_INFO_ENV' object!");
-
-                MPI_Info_free(&info_);
-            }
+            this->free_info();
         }
         ///@}
 
@@ -1268,6 +1494,8 @@ namespace mpicxx {
          * @post The assigned to info object is in a valid state iff @p other is in a valid state.
          * @attention Every copied info object (except if `other.get() == MPI_INFO_NULL`)  is marked **freeable** independent of the
          *            **freeable** state of the copied-from info object.
+         * @attention If @p rhs has the copy-on-write mode enabled (see @ref mpicxx::info::set_copy_on_write(const bool)) and is
+         *            **freeable**, no [*MPI_Info_dup*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) is called.
          *
          * @assert_precondition{ If an attempt is made to free
          *                       [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) or
@@ -1285,22 +1513,10 @@ namespace mpicxx {
             // check against self-assignment
             if (this != std::addressof(rhs)) {
                 // delete current MPI_Info object if and only if it is marked as freeable
-                if (is_freeable_) {
-                    MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_NULL, "Attempt to free a 'MPI_INFO_NULL' object!");
-                    MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_ENV, "Attempt to free a 'MPI_INFO_ENV' object!");
-
-                    MPI_Info_free(&info_);
-                }
+                this->free_info();
                 // copy rhs info object
-                if (rhs.info_ == MPI_INFO_NULL) {
-                    // copy an info object which refers to MPI_INFO_NULL
-                    info_ = MPI_INFO_NULL;
-                    is_freeable_ = rhs.is_freeable_;
-                } else {
-                    // copy normal info object
-                    MPI_Info_dup(rhs.info_, &info_);
-                    is_freeable_ = true;
-                }
+                copy_on_write_ = rhs.copy_on_write_;
+                this->copy_from(rhs);
             }
             return *this;
         }
@@ -1339,15 +1555,12 @@ namespace mpicxx {
             MPICXX_ASSERT_SANITY(!this->identical(rhs), "Attempt to perform a \"self move assignment\"!");
 
             // delete current MPI_Info object if and only if it is marked as freeable
-            if (is_freeable_) {
-                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_NULL, "Attempt to free a 'MPI_INFO_NULL' object!");
-                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_ENV, "Attempt to free a 'MPI_INFO_ENV' object!");
-
-                MPI_Info_free(&info_);
-            }
+            this->free_info();
             // transfer ownership
             info_ = std::move(rhs.info_);
             is_freeable_ = std::move(rhs.is_freeable_);
+            copy_on_write_ = rhs.copy_on_write_;
+            shared_ = std::move(rhs.shared_);
             // set rhs to the moved-from state (referring to MPI_INFO_NULL)
             rhs.info_ = MPI_INFO_NULL;
             rhs.is_freeable_ = false;
@@ -1382,15 +1595,11 @@ namespace mpicxx {
          */
         info& operator=(std::initializer_list<value_type> ilist) {
             // delete current MPI_Info object iff it is marked as freeable and in a valid state
-            if (is_freeable_) {
-                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_NULL, "Attempt to free a 'MPI_INFO_NULL' object!");
-                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_ENV, "Attempt to free a 'MPI_INFO_ENV' object!");
-
-                MPI_Info_free(&info_);
-            }
+            this->free_info();
             // recreate the info object
-            MPI_Info_create(&info_);
+            info_ = info_pool::acquire();
             is_freeable_ = true;
+            this->share();
             // add all [key, value]-pairs
             this->insert_or_assign(ilist);
             return *this;
@@ -1420,6 +1629,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
                     "Attempt to create an iterator from an info object referring to 'MPI_INFO_NULL'!");
 
+            this->detach();
+
             return iterator(info_, 0);
         }
         /**
@@ -1442,6 +1653,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
                     "Attempt to create an iterator from an info object referring to 'MPI_INFO_NULL'!");
 
+            this->detach();
+
             return iterator(info_, this->size());
         }
         /**
@@ -1723,6 +1936,8 @@ namespace mpicxx {
                     "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)",
                     detail::convert_to_string_size(key), MPI_MAX_INFO_KEY);
 
+            this->detach();
+
             // check whether the key exists
             if (!this->key_exists(key)) {
                 // key doesn't exist
@@ -1776,6 +1991,169 @@ namespace mpicxx {
             MPI_Info_get(info_, key.data(), valuelen, value.data(), &flag);
             return value;
         }
+        /**
+         * @brief Copy the value associated with the given @p key into the caller provided @p buffer **without** any heap allocation.
+         * @details Behaves like [`std::snprintf`](https://en.cppreference.com/w/cpp/io/c/fprintf): at most `buffer.size() - 1` characters
+         *          are copied and the result is always null-terminated (if `buffer.size() > 0`). The returned length is the **full** length of
+         *          the value, i.e. the value has been truncated if and only if the returned length is greater or equal than `buffer.size()`.
+         * @param[in] key the @p key of the [key, value]-pair to find
+         * @param[out] buffer the buffer to copy the value to
+         * @return the length of the value associated with @p key (excluding the null-terminator) or
+         *         [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if the @p key doesn't exist
+         * @nodiscard
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre @p key **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If @p key exceeds its size limit. }
+         *
+         * @calls{
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly once
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // at most once
+         * }
+         */
+        [[nodiscard]]
+        std::optional<size_type> get_into(const std::string_view key, const std::span<char> buffer) const {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
+                    "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
+
+            // get the length of the value associated with key
+            int valuelen, flag;
+            MPI_Info_get_valuelen(info_, key.data(), &valuelen, &flag);
+            // check whether the key exists
+            if (!static_cast<bool>(flag)) {
+                // key doesn't exist
+                return std::nullopt;
+            }
+            // get the (possibly truncated) value associated with key
+            if (!buffer.empty()) {
+                const int len = std::min(valuelen, static_cast<int>(buffer.size() - 1));
+                MPI_Info_get(info_, key.data(), len, buffer.data(), &flag);
+                buffer[len] = '\0';
+            }
+            return std::make_optional(static_cast<size_type>(valuelen));
+        }
+        /**
+         * @brief Copy the value associated with the given @p key into @p value reusing its already allocated capacity.
+         * @details Only allocates memory if the capacity of @p value is too small to hold the requested value.
+         * @param[in] key the @p key of the [key, value]-pair to find
+         * @param[inout] value the string to copy the value to; unchanged if the @p key doesn't exist
+         * @return `true` if the @p key exists (and, therefore, @p value has been overwritten), otherwise `false`
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre @p key **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If @p key exceeds its size limit. }
+         *
+         * @calls{
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly once
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // at most once
+         * }
+         */
+        bool try_get(const std::string_view key, std::string& value) const {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
+                    "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
+
+            // get the length of the value associated with key
+            int valuelen, flag;
+            MPI_Info_get_valuelen(info_, key.data(), &valuelen, &flag);
+            // check whether the key exists
+            if (!static_cast<bool>(flag)) {
+                // key doesn't exist
+                return false;
+            }
+            // get the value associated with key (std::string::resize doesn't shrink the capacity)
+            value.resize(valuelen);
+            MPI_Info_get(info_, key.data(), valuelen, value.data(), &flag);
+            return true;
+        }
+        /**
+         * @brief Returns the value associated with the given @p key converted to the type @p T.
+         * @details The conversion uses the locale independent [`std::from_chars`](https://en.cppreference.com/w/cpp/utility/from_chars)
+         *          on a stack buffer, i.e. no heap memory is allocated. `bool`s must be either `"true"` or `"false"` and enums are
+         *          converted using their underlying type. The **whole** value must be consumed by the conversion.
+         * @tparam T must meet the @ref mpicxx::detail::is_chars_convertible requirements
+         * @param[in] key the @p key of the [key, value]-pair to find
+         * @return the converted value or an @ref mpicxx::info_errc describing why no value could be returned
+         * @nodiscard
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre @p key **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If @p key exceeds its size limit. }
+         *
+         * @calls{
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly once
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // at most once
+         * }
+         */
+        template <detail::is_chars_convertible T>
+        [[nodiscard]]
+        expected<T, info_errc> get(const std::string_view key) const {
+            // get the textual representation of the value associated with key
+            char value[MPI_MAX_INFO_VAL];
+            const std::optional<size_type> len = this->get_into(key, value);
+            if (!len.has_value()) {
+                // key doesn't exist
+                return unexpected(info_errc::key_not_found);
+            } else if (len.value() >= sizeof(value)) {
+                // value has been truncated
+                return unexpected(info_errc::invalid_argument);
+            }
+            // convert the value to the requested type
+            const expected<T, std::errc> res = detail::convert_from_chars<T>(std::string_view(value, len.value()));
+            if (!res.has_value()) {
+                return unexpected(res.error() == std::errc::result_out_of_range ? info_errc::result_out_of_range : info_errc::invalid_argument);
+            }
+            return res.value();
+        }
+        /**
+         * @brief Insert or assign the given @p value (converted to its textual representation) associated with the given @p key.
+         * @details The conversion uses the locale independent [`std::to_chars`](https://en.cppreference.com/w/cpp/utility/to_chars)
+         *          on a stack buffer, i.e. no heap memory is allocated. `bool`s are converted to either `"true"` or `"false"`, enums are
+         *          converted using their underlying type and floating point types are converted using their shortest round-trip
+         *          representation.
+         * @tparam T must meet the @ref mpicxx::detail::is_chars_convertible requirements
+         * @param[in] key the @p key of the [key, value]-pair to insert or assign
+         * @param[in] value the value to insert or assign
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre @p key **must** include the null-terminator.
+         * @pre The @p key's length **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If @p key exceeds its size limit. }
+         *
+         * @calls{ int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // exactly once }
+         */
+        template <detail::is_chars_convertible T>
+        void set(const std::string_view key, const T value) {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+            MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
+                    "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
+
+            this->detach();
+
+            // convert the value to its textual representation
+            char buffer[detail::max_chars_size];
+            detail::convert_to_chars(value, buffer);
+            MPI_Info_set(info_, key.data(), buffer);
+        }
         /**
          * @brief Access the value associated with the given @p key.
          * @details Returns a proxy class which is used to distinguish between read and write access. \n
@@ -1810,6 +2188,8 @@ namespace mpicxx {
                     "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)",
                     detail::convert_to_string_size(key), MPI_MAX_INFO_KEY);
 
+            this->detach();
+
             // create proxy object and forward key
             return proxy(info_, std::forward<T>(key));
         }
@@ -1850,6 +2230,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_string_size(value, MPI_MAX_INFO_VAL),
                     "Illegal info value: 0 < {} < {} (MPI_MAX_INFO_VAL)", value.size(), MPI_MAX_INFO_VAL);
 
+            this->detach();
+
             // check whether the key exists
             const bool key_already_exists = this->key_exists(key);
             if (!key_already_exists) {
@@ -1896,6 +2278,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_iterator_range(first, last),
                     "Attempt to pass an illegal iterator range ('first' must be less or equal than 'last')!");
 
+            this->detach();
+
             // try to insert every element in the range [first, last)
             for (; first != last; ++first) {
                 // retrieve element
@@ -1980,6 +2364,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
                     "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
 
+            this->detach();
+
             ([&](auto&& pair) {
                 MPICXX_ASSERT_PRECONDITION(this->legal_string_size(pair.first, MPI_MAX_INFO_KEY),
                         "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)",
@@ -2034,6 +2420,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_string_size(value, MPI_MAX_INFO_VAL),
                     "Illegal info value: 0 < {} < {} (MPI_MAX_INFO_VAL)", value.size(), MPI_MAX_INFO_VAL);
 
+            this->detach();
+
             // check whether an insertion or assignment will take place
             const bool key_already_exists = this->key_exists(key);
             // updated (i.e. insert or assign) the [key, value]-pair
@@ -2074,6 +2462,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_iterator_range(first, last),
                     "Attempt to pass an illegal iterator range ('first' must be less or equal than 'last')!");
 
+            this->detach();
+
             // insert or assign every element in the range [first, last)
             for (; first != last; ++first) {
                 // retrieve element
@@ -2146,6 +2536,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
                     "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
 
+            this->detach();
+
             ([&](auto&& pair) {
                 MPICXX_ASSERT_PRECONDITION(this->legal_string_size(pair.first, MPI_MAX_INFO_KEY),
                         "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)",
@@ -2161,23 +2553,198 @@ namespace mpicxx {
         }
 
         /**
-         * @brief Erase all [key, value]-pairs from the info object.
+         * @brief Inserts all [key, value]-pairs from the range [@p first, @p last) if the info object does not already contain a
+         *        [key, value]-pair with an equivalent key and returns the number of newly inserted [key, value]-pairs.
+         * @details If multiple [key, value]-pairs in the range have the same key, the **first** occurrence determines the final value.
+         *
+         *          In contrast to @ref insert(InputIt, InputIt) the range is deduplicated in a single pass **before** any MPI call is
+         *          issued, i.e. duplicated keys don't result in additional existence probes. No iterators are constructed.
+         * @tparam InputIt must meet the [LegacyInputIterator](https://en.cppreference.com/w/cpp/named_req/InputIterator) requirements
+         * @param[in] first iterator to the first [key, value]-pair in the range
+         * @param[in] last iterator one-past the last [key, value]-pair in the range
+         * @return the number of inserted [key, value]-pairs
          *
          * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
-         * @post The info object is empty, i.e. `this->size() == 0` respectively `this->empty() == true`.
-         * @post Invalidates **all** iterators referring to `*this`.
+         * @pre @p first and @p last **must** refer to the same container.
+         * @pre @p first and @p last **must** form a valid range, i.e. @p first must be less or equal than @p last.
+         * @pre The length of **any** key **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The length of **any** value **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_VAL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @post As of [MPI standard 3.1](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report.pdf) all iterators referring to `*this`
+         *       are invalidated, if an insertion took place. \n
+         *       Specific MPI implementations **may** differ in this regard, i.e. iterators before the first insertion point remain valid,
+         *       all other iterators are invalidated.
          *
-         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If @p first and @p last don't denote a valid range. \n
+         *                       If any key or value exceed their size limit. }
          *
          * @calls{
-         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);           // exactly once
-         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);    // exactly 'this->size()' times
-         * int MPI_Info_delete(MPI_Info info, const char *key);         // exactly 'this->size()' times
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);    // exactly once per unique key
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);                    // at most once per unique key
          * }
          */
-        void clear() {
+        template <std::input_iterator InputIt>
+        size_type insert_bulk(InputIt first, InputIt last) requires (!detail::is_c_string<InputIt>) {
             MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
                     "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+            MPICXX_ASSERT_PRECONDITION(this->legal_iterator_range(first, last),
+                    "Attempt to pass an illegal iterator range ('first' must be less or equal than 'last')!");
+
+            this->detach();
+
+            // deduplicate the range keeping the first occurrence of each key
+            const bulk_range range = this->deduplicate(first, last, false);
+
+            // insert every unique [key, value]-pair whose key doesn't exist yet
+            size_type count = 0;
+            for (const auto& [key, value] : range.pairs) {
+                if (!this->key_exists(*key)) {
+                    MPI_Info_set(info_, key->data(), value.data());
+                    ++count;
+                }
+            }
+            return count;
+        }
+        /**
+         * @brief Inserts all [key, value]-pairs from the
+         *        [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) @p ilist if the info object does
+         *        not already contain a [key, value]-pair with an equivalent key and returns the number of newly inserted
+         *        [key, value]-pairs.
+         * @details If multiple [key, value]-pairs in the
+         *          [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) have the same key, the **first**
+         *          occurrence determines the final value.
+         * @param[in] ilist [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) to insert the
+         *                  [key, value]-pairs from
+         * @return the number of inserted [key, value]-pairs
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The length of **any** key **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The length of **any** value **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_VAL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @post As of [MPI standard 3.1](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report.pdf) all iterators referring to `*this`
+         *       are invalidated, if an insertion took place. \n
+         *       Specific MPI implementations **may** differ in this regard, i.e. iterators before the first insertion point remain valid,
+         *       all other iterators are invalidated.
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If any key or value exceed their size limit. }
+         *
+         * @calls{
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);    // exactly once per unique key
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);                    // at most once per unique key
+         * }
+         */
+        size_type insert_bulk(std::initializer_list<value_type> ilist) {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+
+            return this->insert_bulk(ilist.begin(), ilist.end());
+        }
+        /**
+         * @brief Inserts or assigns all [key, value]-pairs from the range [@p first, @p last) to the info object and returns the number
+         *        of distinct keys written.
+         * @details If multiple [key, value]-pairs in the range have the same key, the **last** occurrence determines the final value.
+         *
+         *          In contrast to @ref insert_or_assign(InputIt, InputIt) the range is deduplicated in a single pass **before** any MPI call
+         *          is issued, i.e. every distinct key is set exactly once. No existence probes are performed and no iterators are
+         *          constructed.
+         * @tparam InputIt must meet the [LegacyInputIterator](https://en.cppreference.com/w/cpp/named_req/InputIterator) requirements
+         * @param[in] first iterator to the first [key, value]-pair in the range
+         * @param[in] last iterator one-past the last [key, value]-pair in the range
+         * @return the number of distinct keys in the range [@p first, @p last)
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre @p first and @p last **must** refer to the same container.
+         * @pre @p first and @p last **must** form a valid range, i.e. @p first must be less or equal than @p last.
+         * @pre The length of **any** key **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The length of **any** value **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_VAL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @post As of [MPI standard 3.1](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report.pdf) all iterators referring to `*this`
+         *       are invalidated, if an insertion took place. \n
+         *       Specific MPI implementations **may** differ in this regard, i.e. iterators before the first insertion point remain valid,
+         *       all other iterators are invalidated.
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If @p first and @p last don't denote a valid range. \n
+         *                       If any key or value exceed their size limit. }
+         *
+         * @calls{ int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // exactly once per unique key }
+         */
+        template <std::input_iterator InputIt>
+        size_type assign_bulk(InputIt first, InputIt last) requires (!detail::is_c_string<InputIt>) {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+            MPICXX_ASSERT_PRECONDITION(this->legal_iterator_range(first, last),
+                    "Attempt to pass an illegal iterator range ('first' must be less or equal than 'last')!");
+
+            this->detach();
+
+            // deduplicate the range keeping the last occurrence of each key
+            const bulk_range range = this->deduplicate(first, last, true);
+
+            // insert or assign every unique [key, value]-pair
+            for (const auto& [key, value] : range.pairs) {
+                MPI_Info_set(info_, key->data(), value.data());
+            }
+            return range.pairs.size();
+        }
+        /**
+         * @brief Inserts or assigns all [key, value]-pairs from the
+         *        [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) @p ilist to the info object and
+         *        returns the number of distinct keys written.
+         * @details If multiple [key, value]-pairs in the
+         *          [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) have the same key, the **last**
+         *          occurrence determines the final value.
+         * @param[in] ilist [`std::initializer_list`](https://en.cppreference.com/w/cpp/utility/initializer_list) to insert or assign the
+         *                  [key, value]-pairs from
+         * @return the number of distinct keys in @p ilist
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The length of **any** key **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @pre The length of **any** value **must** be greater than 0 and less than
+         *      [*MPI_MAX_INFO_VAL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @post As of [MPI standard 3.1](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report.pdf) all iterators referring to `*this`
+         *       are invalidated, if an insertion took place. \n
+         *       Specific MPI implementations **may** differ in this regard, i.e. iterators before the first insertion point remain valid,
+         *       all other iterators are invalidated.
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+         *                       If any key or value exceed their size limit. }
+         *
+         * @calls{ int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // exactly once per unique key }
+         */
+        size_type assign_bulk(std::initializer_list<value_type> ilist) {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+
+            return this->assign_bulk(ilist.begin(), ilist.end());
+        }
+
+        /**
+         * @brief Erase all [key, value]-pairs from the info object.
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         * @post The info object is empty, i.e. `this->size() == 0` respectively `this->empty() == true`.
+         * @post Invalidates **all** iterators referring to `*this`.
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);           // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);    // exactly 'this->size()' times
+         * int MPI_Info_delete(MPI_Info info, const char *key);         // exactly 'this->size()' times
+         * }
+         */
+        void clear() {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+
+            this->detach();
 
             const size_type size = this->size();
             char key[MPI_MAX_INFO_KEY];
@@ -2219,6 +2786,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_info_iterator(pos), "Attempt to use an info iterator referring to another info object!");
             MPICXX_ASSERT_PRECONDITION(this->info_iterator_valid(pos), "Attempt to dereference a {} iterator!", pos.state());
 
+            this->detach();
+
             char key[MPI_MAX_INFO_KEY];
             MPI_Info_get_nthkey(info_, pos.pos_, key);
             MPI_Info_delete(info_, key);
@@ -2278,6 +2847,8 @@ namespace mpicxx {
             MPICXX_ASSERT_SANITY(this->legal_iterator_range(first, last),
                     "Attempt to pass an illegal iterator range ('first' must be less or equal than 'last')!");
 
+            this->detach();
+
             const difference_type count = last - first;
             char key[MPI_MAX_INFO_KEY];
             std::vector<std::string> keys_to_delete(count);
@@ -2324,6 +2895,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
                     "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
 
+            this->detach();
+
             // check whether the key exists
             if (this->key_exists(key)) {
                 // key exists -> delete the [key, value]-pair
@@ -2345,6 +2918,8 @@ namespace mpicxx {
             using std::swap;
             swap(info_, other.info_);
             swap(is_freeable_, other.is_freeable_);
+            swap(copy_on_write_, other.copy_on_write_);
+            swap(shared_, other.shared_);
         }
 
         /**
@@ -2379,6 +2954,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_info_iterator(pos), "Attempt to use an info iterator referring to another info object!");
             MPICXX_ASSERT_PRECONDITION(this->info_iterator_valid(pos), "Attempt to dereference a {} iterator!", pos.state());
 
+            this->detach();
+
             // get [key, value]-pair pointed to by pos
             const value_type& pair = *pos;
             // remove [key, value]-pair from info object
@@ -2419,6 +2996,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
                     "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
 
+            this->detach();
+
             // check whether the key exists
             int valuelen, flag;
             MPI_Info_get_valuelen(info_, key.data(), &valuelen, &flag);
@@ -2480,6 +3059,9 @@ namespace mpicxx {
                     "Attempt to call a function on an info object ('source') referring to 'MPI_INFO_NULL'!");
             MPICXX_ASSERT_SANITY(!this->identical(source), "Attempt to perform a \"self merge\"!");
 
+            this->detach();
+            source.detach();
+
             // do nothing if a "self merge" is attempted
             if (this == std::addressof(source)) return;
 
@@ -2578,6 +3160,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
                     "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
 
+            this->detach();
+
             const size_type size = this->size();
             return iterator(info_, this->find_pos(key, size));
         }
@@ -2676,6 +3260,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(this->legal_string_size(key, MPI_MAX_INFO_KEY),
                     "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", key.size(), MPI_MAX_INFO_KEY);
 
+            this->detach();
+
             const size_type size = this->size();
             const size_type pos = this->find_pos(key, size);
             if (pos != size) {
@@ -2807,6 +3393,64 @@ namespace mpicxx {
             // all elements are equal
             return true;
         }
+        /**
+         * @brief Compares the contents of the two info objects for equality, rejecting early on a size or fingerprint mismatch.
+         * @details Returns the same result as @ref mpicxx::info::operator==(const info&, const info&), but performs at most one dynamic
+         *          memory allocation (the snapshot of @p lhs) instead of two per [key, value]-pair: \n
+         *          1. if the sizes differ the info objects can't compare equal \n
+         *          2. if the @ref fingerprint() const of @p lhs and @p rhs differ the info objects can't compare equal (no dynamic memory
+         *             allocation is performed until here) \n
+         *          3. otherwise a snapshot of @p lhs is taken and every [key, value]-pair of it is looked up in @p rhs using a single scratch
+         *             buffer
+         * @param[in] lhs the @p lhs info object to compare
+         * @param[in] rhs the @p rhs info object to compare
+         * @return `true` if the contents of the info objects are equal, `false` otherwise
+         * @nodiscard
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);                                         // at most five times
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);                                  // at most '3 * lhs.size()' times
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // at most '4 * lhs.size()' times
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // at most '4 * lhs.size()' times
+         * }
+         */
+        [[nodiscard]]
+        friend bool fast_equal(const info& lhs, const info& rhs) {
+            // if both info object refer to MPI_INFO_NULL they compare equal
+            if (lhs.info_ == MPI_INFO_NULL && rhs.info_ == MPI_INFO_NULL) return true;
+            // if only one info object refers to MPI_INFO_NULL they don't compare equal
+            if (lhs.info_ == MPI_INFO_NULL || rhs.info_ == MPI_INFO_NULL) return false;
+            // the same underlying MPI_Info object always compares equal
+            if (lhs.info_ == rhs.info_) return true;
+
+            // not the same number of [key, value]-pairs therefore can't compare equal
+            if (lhs.size() != rhs.size()) return false;
+
+            // different fingerprints therefore can't compare equal (allocation free, checked before taking the snapshot)
+            if (lhs.fingerprint() != rhs.fingerprint()) return false;
+
+            const snapshot_type lhs_snapshot = lhs.snapshot();
+
+            // check all [key, value]-pairs for equality
+            char value[MPI_MAX_INFO_VAL + 1];
+            for (const auto& [key, lhs_value] : lhs_snapshot) {
+                // check if rhs contains the current key with a value of the same length
+                int valuelen, flag;
+                MPI_Info_get_valuelen(rhs.info_, key.data(), &valuelen, &flag);
+                if (!static_cast<bool>(flag) || static_cast<std::size_t>(valuelen) != lhs_value.size()) {
+                    return false;
+                }
+
+                // retrieve the rhs value into the scratch buffer and compare
+                MPI_Info_get(rhs.info_, key.data(), valuelen, value, &flag);
+                if (lhs_value != std::string_view(value, static_cast<std::size_t>(valuelen))) {
+                    return false;
+                }
+            }
+
+            // all elements are equal
+            return true;
+        }
         /**
          * @brief Specializes the [`std::swap`](https://en.cppreference.com/w/cpp/algorithm/swap) algorithm for info objects.
          *        Swaps the contents of @p lhs and @p rhs.
@@ -2854,6 +3498,8 @@ namespace mpicxx {
             MPICXX_ASSERT_PRECONDITION(!c.refers_to_mpi_info_null(),
                     "Attempt to call a function on an info object ('c') referring to 'MPI_INFO_NULL'!");
 
+            c.detach();
+
             size_type size = c.size();
             char key[MPI_MAX_INFO_KEY];
 
@@ -2883,6 +3529,61 @@ namespace mpicxx {
                 MPI_Info_delete(c.info_, str.data());
             }
         }
+        /**
+         * @brief Broadcasts the info object @p obj from the process with rank @p root to all other processes of @p comm.
+         * @details The info object is serialized using @ref pack() const, such that exactly two
+         *          [*MPI_Bcast*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node101.htm) calls are issued (one for the size and one
+         *          for the payload) regardless of the number of [key, value]-pairs. \n
+         *          On all processes except @p root, @p obj gets replaced by the received info object.
+         *
+         *          This is a collective operation, i.e. it **must** be called by all processes of @p comm.
+         * @param[inout] obj the info object to broadcast (on @p root) or to receive into (on all other processes)
+         * @param[in] root the rank of the broadcasting process
+         * @param[in] comm the communicator
+         *
+         * @pre On @p root, @p obj **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p obj refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm)
+         *                       on @p root. }
+         *
+         * @throws std::length_error if the serialized info object is larger than `std::numeric_limits<int>::max()` bytes (thrown on
+         *         **all** processes after the size has been broadcast, the payload isn't broadcast)
+         *
+         * @calls{
+         * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                               // exactly once
+         * int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);    // at most twice
+         * }
+         * and the MPI functions called by @ref pack() const (on @p root) respectively @ref unpack() (on all other processes).
+         */
+        friend void broadcast_info(info& obj, const int root, const MPI_Comm comm) {
+            int rank;
+            MPI_Comm_rank(comm, &rank);
+
+            // serialize the info object on root
+            std::vector<std::byte> buffer;
+            if (rank == root) {
+                MPICXX_ASSERT_PRECONDITION(!obj.refers_to_mpi_info_null(),
+                        "Attempt to broadcast an info object referring to 'MPI_INFO_NULL'!");
+                buffer = obj.pack();
+            }
+
+            // broadcast the size of the serialized info object (also if it is too large, such that no process waits for the payload)
+            std::uint64_t size = buffer.size();
+            MPI_Bcast(&size, 1, MPI_UINT64_T, root, comm);
+            if (size > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+                throw std::length_error(fmt::format("The serialized info object size (which is {}) is greater than the maximum possible size (which is {})!",
+                        size, std::numeric_limits<int>::max()));
+            }
+
+            // broadcast the payload
+            buffer.resize(size);
+            MPI_Bcast(buffer.data(), static_cast<int>(size), MPI_BYTE, root, comm);
+
+            // deserialize the info object on all other processes
+            if (rank != root) {
+                obj = info::unpack(buffer);
+            }
+        }
         ///@}
 
 
@@ -2964,6 +3665,307 @@ namespace mpicxx {
 
             return values;
         }
+        /**
+         * @brief Returns a read-only, random access snapshot of all [key, value]-pairs of the info object.
+         * @details In contrast to iterating over the info object directly (which allocates two
+         *          [`std::string`](https://en.cppreference.com/w/cpp/string/basic_string) per dereferenced [key, value]-pair),
+         *          all [key, value]-pairs are copied into a **single** allocation and can be accessed as
+         *          [`std::string_view`](https://en.cppreference.com/w/cpp/string/basic_string_view) pairs. \n
+         *          Changes to the info object after the call to this function aren't reflected in the snapshot.
+         * @return the snapshot of all [key, value]-pairs (see @ref mpicxx::info::snapshot_view)
+         * @nodiscard
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);                                         // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);                                  // exactly 'this->size()' times
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly 'this->size()' times
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // exactly 'this->size()' times
+         * }
+         */
+        [[nodiscard]]
+        snapshot_type snapshot() const {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+
+            return snapshot_type(info_);
+        }
+        /**
+         * @brief Returns an order-independent 64-bit hash of all [key, value]-pairs of the info object.
+         * @details Two info objects containing the same [key, value]-pairs (in any order) have the same fingerprint. Different
+         *          fingerprints imply different [key, value]-pairs, but equal fingerprints **don't** imply equal info objects. \n
+         *          No dynamic memory allocation is performed.
+         * @return the fingerprint
+         * @nodiscard
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);                                         // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);                                  // exactly 'this->size()' times
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly 'this->size()' times
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // exactly 'this->size()' times
+         * }
+         */
+        [[nodiscard]]
+        std::uint64_t fingerprint() const {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+
+            const size_type size = this->size();
+            std::uint64_t hash = 0;
+            char key[MPI_MAX_INFO_KEY];
+            char value[MPI_MAX_INFO_VAL + 1];
+
+            for (size_type i = 0; i < size; ++i) {
+                MPI_Info_get_nthkey(info_, i, key);
+                int valuelen, flag;
+                MPI_Info_get_valuelen(info_, key, &valuelen, &flag);
+                MPI_Info_get(info_, key, valuelen, value, &flag);
+                // sum of the hashes is independent of the order of the [key, value]-pairs
+                hash += detail::hash_pair(key, std::string_view(value, static_cast<std::size_t>(valuelen)));
+            }
+
+            return hash;
+        }
+        /**
+         * @brief Serializes all [key, value]-pairs of the info object into a compact, length-prefixed byte buffer.
+         * @details The buffer has the following layout (all lengths are `std::uint32_t` in native byte order, the strings **aren't**
+         *          null-terminated):
+         *          `[size] [key_0 length] [key_0] [value_0 length] [value_0] ... [key_n-1 length] [key_n-1] [value_n-1 length] [value_n-1]` \n
+         *          Therefore, the buffer can only be deserialized using @ref unpack() on a machine with the same byte order.
+         * @return the serialized info object
+         * @nodiscard
+         *
+         * @pre `*this` **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If `*this` refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);                                         // exactly once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);                                  // exactly 'this->size()' times
+         * int MPI_Info_get_valuelen(MPI_Info info, const char *key, int *valuelen, int *flag);       // exactly 'this->size()' times
+         * int MPI_Info_get(MPI_Info info, const char *key, int valuelen, char *value, int *flag);    // exactly 'this->size()' times
+         * }
+         */
+        [[nodiscard]]
+        std::vector<std::byte> pack() const {
+            MPICXX_ASSERT_PRECONDITION(!this->refers_to_mpi_info_null(),
+                    "Attempt to call a function on an info object referring to 'MPI_INFO_NULL'!");
+
+            const snapshot_type snapshot = this->snapshot();
+
+            // calculate the size of the buffer
+            size_type bytes = sizeof(std::uint32_t);
+            for (const auto& [key, value] : snapshot) {
+                bytes += 2 * sizeof(std::uint32_t) + key.size() + value.size();
+            }
+
+            // serialize all [key, value]-pairs
+            std::vector<std::byte> buffer;
+            buffer.reserve(bytes);
+            const auto write = [&buffer](const void* src, const std::size_t count) {
+                const auto* data = static_cast<const std::byte*>(src);
+                buffer.insert(buffer.end(), data, data + count);
+            };
+            const auto size = static_cast<std::uint32_t>(snapshot.size());
+            write(&size, sizeof(size));
+            for (const auto& [key, value] : snapshot) {
+                const auto key_size = static_cast<std::uint32_t>(key.size());
+                write(&key_size, sizeof(key_size));
+                write(key.data(), key.size());
+                const auto value_size = static_cast<std::uint32_t>(value.size());
+                write(&value_size, sizeof(value_size));
+                write(value.data(), value.size());
+            }
+
+            return buffer;
+        }
+        /**
+         * @brief Creates a new info object from the @p buffer previously created by @ref pack() const.
+         * @param[in] buffer the serialized info object
+         * @return the deserialized info object
+         * @nodiscard
+         *
+         * @throws std::invalid_argument if @p buffer isn't a valid serialized info object, i.e. it is truncated, has trailing bytes or
+         *                               contains a key or value with an illegal size
+         *
+         * @calls{
+         * int MPI_Info_create(MPI_Info *info);                                    // exactly once
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // at most 'size' times (stored in @p buffer)
+         * int MPI_Info_free(MPI_info *info);                                      // at most once (if an exception is thrown)
+         * }
+         */
+        [[nodiscard]]
+        static info unpack(const std::span<const std::byte> buffer) {
+            const std::byte* ptr = buffer.data();
+            const std::byte* const end = ptr + buffer.size();
+            const auto read_size = [&]() {
+                std::uint32_t size;
+                if (static_cast<std::size_t>(end - ptr) < sizeof(size)) {
+                    throw std::invalid_argument("Truncated info buffer!");
+                }
+                std::memcpy(&size, ptr, sizeof(size));
+                ptr += sizeof(size);
+                return size;
+            };
+            const auto read_string = [&](char* dest, const std::size_t max_size) {
+                const std::uint32_t size = read_size();
+                if (size == 0 || size >= max_size) {
+                    throw std::invalid_argument(fmt::format("Illegal string size in info buffer: 0 < {} < {}", size, max_size));
+                }
+                if (static_cast<std::size_t>(end - ptr) < size) {
+                    throw std::invalid_argument("Truncated info buffer!");
+                }
+                std::memcpy(dest, ptr, size);
+                dest[size] = '\0';
+                ptr += size;
+            };
+
+            info obj;
+            const std::uint32_t size = read_size();
+            char key[MPI_MAX_INFO_KEY];
+            char value[MPI_MAX_INFO_VAL];
+            for (std::uint32_t i = 0; i < size; ++i) {
+                read_string(key, MPI_MAX_INFO_KEY);
+                read_string(value, MPI_MAX_INFO_VAL);
+                MPI_Info_set(obj.info_, key, value);
+            }
+            if (ptr != end) {
+                throw std::invalid_argument(fmt::format("{} trailing bytes in info buffer!", end - ptr));
+            }
+
+            return obj;
+        }
+        /**
+         * @brief Creates a new info object from the hints file @p path.
+         * @details The file is memory-mapped and tokenized without copying it. The expected format is the one of ROMIO hints files,
+         *          i.e. one [key, value]-pair per line, where the key and value are separated by whitespace: \n
+         *          `key value` \n
+         *          Leading and trailing whitespace is ignored, everything after a `#` is treated as a comment and empty lines are
+         *          skipped. The value is the remainder of the line (after the first whitespace following the key). \n
+         *          If a key occurs multiple times, the **last** occurrence determines the final value.
+         * @param[in] path the hints file
+         * @return the info object containing all [key, value]-pairs of the hints file
+         * @nodiscard
+         *
+         * @throws std::system_error if the file can't be opened or mapped
+         * @throws std::invalid_argument if a line contains no value or a key or value exceeds its size limit
+         *
+         * @calls{
+         * int MPI_Info_create(MPI_Info *info);                                    // exactly once
+         * int MPI_Info_set(MPI_Info info, const char *key, const char *value);    // exactly once per [key, value]-pair
+         * int MPI_Info_free(MPI_info *info);                                      // at most once (if an exception is thrown)
+         * }
+         */
+        [[nodiscard]]
+        static info from_file(const std::filesystem::path& path) {
+            const detail::mapped_file file(path);
+            std::string_view content = file.view();
+
+            info obj;
+            char key[MPI_MAX_INFO_KEY];
+            char value[MPI_MAX_INFO_VAL];
+            const auto copy = [](char* dest, const std::string_view str) {
+                std::memcpy(dest, str.data(), str.size());
+                dest[str.size()] = '\0';
+            };
+
+            for (size_type line_number = 1; !content.empty(); ++line_number) {
+                // extract the next line
+                const std::size_t eol = content.find('\n');
+                std::string_view line = content.substr(0, eol);
+                content.remove_prefix(eol == std::string_view::npos ? content.size() : eol + 1);
+
+                // remove comments and surrounding whitespace
+                line = info::trim(line.substr(0, line.find('#')));
+                if (line.empty()) continue;
+
+                // split into key and value
+                const std::size_t sep = line.find_first_of(whitespace);
+                if (sep == std::string_view::npos) {
+                    throw std::invalid_argument(fmt::format("{}:{}: missing value for key '{}'!", path.string(), line_number, line));
+                }
+                const std::string_view key_view = line.substr(0, sep);
+                const std::string_view value_view = info::trim(line.substr(sep));
+                if (key_view.size() >= info::max_key_size()) {
+                    throw std::invalid_argument(fmt::format("{}:{}: illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)",
+                            path.string(), line_number, key_view.size(), info::max_key_size()));
+                }
+                if (value_view.size() >= info::max_value_size()) {
+                    throw std::invalid_argument(fmt::format("{}:{}: illegal info value: 0 < {} < {} (MPI_MAX_INFO_VAL)",
+                            path.string(), line_number, value_view.size(), info::max_value_size()));
+                }
+
+                // add [key, value]-pair
+                copy(key, key_view);
+                copy(value, value_view);
+                MPI_Info_set(obj.info_, key, value);
+            }
+
+            return obj;
+        }
+        /**
+         * @brief Creates a new info object from the hints file @p path, which is only read by the process with rank @p root.
+         * @details The info object read by @p root (see @ref from_file(const std::filesystem::path&)) is broadcasted to all other
+         *          processes of @p comm using @ref broadcast_info(info&, const int, const MPI_Comm). Therefore, the file is only opened
+         *          once, regardless of the number of processes. \n
+         *          If reading the file fails on @p root, the exception is rethrown on @p root and all other processes throw a
+         *          [`std::runtime_error`](https://en.cppreference.com/w/cpp/error/runtime_error).
+         *
+         *          This is a collective operation, i.e. it **must** be called by all processes of @p comm.
+         * @param[in] path the hints file (only used on @p root)
+         * @param[in] root the rank of the process reading the file
+         * @param[in] comm the communicator
+         * @return the info object containing all [key, value]-pairs of the hints file
+         * @nodiscard
+         *
+         * @throws std::system_error on @p root if the file can't be opened or mapped
+         * @throws std::invalid_argument on @p root if a line contains no value or a key or value exceeds its size limit
+         * @throws std::runtime_error on all processes except @p root if reading the file failed on @p root
+         *
+         * @calls{
+         * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                               // exactly once
+         * int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);    // exactly once
+         * }
+         * and the MPI functions called by @ref from_file(const std::filesystem::path&) (on @p root) and
+         * @ref broadcast_info(info&, const int, const MPI_Comm) (on all processes if no exception has been thrown).
+         */
+        [[nodiscard]]
+        static info from_file(const std::filesystem::path& path, const int root, const MPI_Comm comm) {
+            int rank;
+            MPI_Comm_rank(comm, &rank);
+
+            // read the file on root only
+            info obj;
+            std::exception_ptr exception;
+            if (rank == root) {
+                try {
+                    obj = info::from_file(path);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+            }
+
+            // inform all processes whether reading the file succeeded
+            int failed = static_cast<int>(exception != nullptr);
+            MPI_Bcast(&failed, 1, MPI_INT, root, comm);
+            if (static_cast<bool>(failed)) {
+                if (rank == root) {
+                    std::rethrow_exception(exception);
+                }
+                throw std::runtime_error(fmt::format("Reading the hints file '{}' failed on rank {}!", path.string(), root));
+            }
+
+            // distribute the info object
+            broadcast_info(obj, root, comm);
+            return obj;
+        }
         /**
          * @brief Returns the maximum possible key size of any [key, value]-pair.
          * @return the maximum key size (= [*MPI_MAX_INFO_KEY*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm))
@@ -2993,12 +3995,20 @@ namespace mpicxx {
         const MPI_Info& get() const noexcept { return info_; }
         /**
          * @brief Get the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object.
+         * @details If the [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object is currently shared with
+         *          other info objects (copy-on-write mode), it gets duplicated first since it may be modified through the returned
+         *          reference.
          * @return the [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object wrapped in this
          *         @ref mpicxx::info object
          * @nodiscard
+         *
+         * @calls{ int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most once }
          */
         [[nodiscard]]
-        MPI_Info& get() noexcept { return info_; }
+        MPI_Info& get() {
+            this->detach();
+            return info_;
+        }
         /**
          * @brief Returns whether the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object gets
          *        automatically freed upon destruction, i.e. the destructor calls
@@ -3009,10 +4019,136 @@ namespace mpicxx {
          */
         [[nodiscard]]
         bool freeable() const noexcept { return is_freeable_; }
+        /**
+         * @brief Returns whether the copy-on-write mode is enabled.
+         * @return `true` if copies of this info object share its
+         *         [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object, `false` otherwise
+         * @nodiscard
+         */
+        [[nodiscard]]
+        bool copy_on_write() const noexcept { return copy_on_write_; }
+        /**
+         * @brief Enables or disables the copy-on-write mode.
+         * @details If enabled, copying a **freeable** info object doesn't call
+         *          [*MPI_Info_dup*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). Instead, the copies share the same
+         *          [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object (using a reference count) and the
+         *          [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object is lazily duplicated on the first
+         *          modifying access (e.g. @ref mpicxx::info::insert(const std::string_view, const std::string_view),
+         *          @ref mpicxx::info::erase(const std::string_view), a write through a proxy or any other non-const member function
+         *          returning an iterator, proxy or the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm)
+         *          object). The last info object sharing the
+         *          [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object frees it. \n
+         *          The copy-on-write mode is inherited by all copies.
+         * @param[in] enable `true` to enable the copy-on-write mode, `false` to disable it
+         *
+         * @attention Every modification has to be done **through this info object**: iterators or proxies created **before** a copy was
+         *            made, or a [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) handle obtained via
+         *            @ref mpicxx::info::get() const, would otherwise modify all info objects sharing the same
+         *            [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object.
+         * @attention The reference count is thread-safe and the same info object may be copied concurrently, but concurrently
+         *            modifying **and** copying the same info object is not.
+         */
+        void set_copy_on_write(const bool enable) {
+            copy_on_write_ = enable;
+            this->share();
+        }
         ///@}
 
 
     private:
+        /*
+         * @brief Reference counted handle to a [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object shared
+         *        by multiple info objects in the copy-on-write mode.
+         * @details Frees the [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object when the last info object
+         *          sharing it is destroyed (if it wasn't released before).
+         */
+        struct shared_handle {
+            MPI_Info info;
+            ~shared_handle() {
+                if (info != MPI_INFO_NULL) {
+                    info_pool::release(info);
+                }
+            }
+        };
+
+        /*
+         * @brief Creates the reference counted handle if the copy-on-write mode is enabled and `*this` owns its
+         *        [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object.
+         * @details The handle is created eagerly (and not on the first copy) such that copying a const info object never modifies it,
+         *          i.e. the same info object can safely be copied concurrently.
+         */
+        void share() {
+            if (copy_on_write_ && is_freeable_ && info_ != MPI_INFO_NULL && shared_ == nullptr) {
+                shared_ = std::make_shared<shared_handle>(info_);
+            }
+        }
+        /*
+         * @brief Copies @p other to `*this` (either by duplicating or sharing the underlying
+         *        [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object).
+         * @param[in] other the copied info object
+         *
+         * @calls{ int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most once }
+         */
+        void copy_from(const info& other) {
+            if (other.info_ == MPI_INFO_NULL) {
+                // copy an info object which refers to MPI_INFO_NULL
+                info_ = MPI_INFO_NULL;
+                is_freeable_ = other.is_freeable_;
+            } else if (other.copy_on_write_ && other.shared_ != nullptr) {
+                // share the MPI_Info object (only reads other, i.e. concurrent copies are safe)
+                info_ = other.info_;
+                shared_ = other.shared_;
+                is_freeable_ = true;
+            } else {
+                // copy normal info object
+                MPI_Info_dup(other.info_, &info_);
+                is_freeable_ = true;
+                this->share();
+            }
+        }
+        /*
+         * @brief Ensures that `*this` exclusively owns its [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm)
+         *        object before it gets modified.
+         * @details If the [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object is shared with other info
+         *          objects, it gets duplicated (and, if the copy-on-write mode is still enabled, gets its own reference counted handle).
+         *          If `*this` is the last info object sharing it and the copy-on-write mode has been disabled, the ownership is transferred
+         *          back to `*this`. Otherwise, does nothing.
+         *
+         * @calls{ int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most once }
+         */
+        void detach() {
+            if (shared_ != nullptr) {
+                if (shared_.use_count() > 1) {
+                    // other info objects share the MPI_Info object -> duplicate it
+                    MPI_Info_dup(shared_->info, &info_);
+                    shared_.reset();
+                    this->share();
+                } else if (!copy_on_write_) {
+                    // last info object sharing the MPI_Info object -> take back the ownership
+                    shared_->info = MPI_INFO_NULL;
+                    shared_.reset();
+                }
+            }
+        }
+        /*
+         * @brief Frees the underlying [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object if and only if
+         *        `*this` is marked freeable. A shared [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) object
+         *        is only freed by the last info object sharing it. \n
+         *        If the @ref mpicxx::info_pool is enabled and not full, the handle gets cleared and parked in the pool instead.
+         *
+         * @calls{ int MPI_Info_free(MPI_info *info);    // at most once }
+         */
+        void free_info() {
+            if (shared_ != nullptr) {
+                shared_.reset();
+            } else if (is_freeable_) {
+                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_NULL, "Attempt to free a 'MPI_INFO_NULL' object!");
+                MPICXX_ASSERT_PRECONDITION(info_ != MPI_INFO_ENV, "Attempt to free a 'MPI_INFO_ENV' object!");
+
+                info_pool::release(info_);
+            }
+        }
+
         /*
          * @brief Finds the position of the given @p key in the info object.
          * @param[in] key the @p key to find
@@ -3038,6 +4174,62 @@ namespace mpicxx {
             return size;
         }
 
+        /*
+         * @brief The result of @ref deduplicate(): the unique [key, value]-pairs in order of the first occurrence of their key.
+         * @details The keys are owned by the nodes of @ref index, which are stable, and referenced from @ref pairs.
+         */
+        struct bulk_range {
+            std::unordered_map<std::string, size_type> index;
+            std::vector<std::pair<const std::string*, std::string>> pairs;
+        };
+        /*
+         * @brief Deduplicates the [key, value]-pairs in the range [@p first, @p last) in a single pass.
+         * @tparam InputIt must meet the [LegacyInputIterator](https://en.cppreference.com/w/cpp/named_req/InputIterator) requirements
+         * @param[in] first iterator to the first [key, value]-pair in the range
+         * @param[in] last iterator one-past the last [key, value]-pair in the range
+         * @param[in] keep_last if `true` the **last** occurrence of a key determines its value, otherwise the **first** one
+         * @return the unique [key, value]-pairs
+         *
+         * @assert_precondition{ If any key or value exceed their size limit. }
+         */
+        template <std::input_iterator InputIt>
+        bulk_range deduplicate(InputIt first, InputIt last, const bool keep_last) const {
+            bulk_range range;
+            for (; first != last; ++first) {
+                // retrieve element
+                const value_type& pair = *first;
+
+                MPICXX_ASSERT_PRECONDITION(this->legal_string_size(pair.first, MPI_MAX_INFO_KEY),
+                        "Illegal info key: 0 < {} < {} (MPI_MAX_INFO_KEY)", pair.first.size(), MPI_MAX_INFO_KEY);
+                MPICXX_ASSERT_PRECONDITION(this->legal_string_size(pair.second, MPI_MAX_INFO_VAL),
+                        "Illegal info value: 0 < {} < {} (MPI_MAX_INFO_VAL)", pair.second.size(), MPI_MAX_INFO_VAL);
+
+                const auto [it, inserted] = range.index.try_emplace(pair.first, range.pairs.size());
+                if (inserted) {
+                    // first occurrence of this key
+                    range.pairs.emplace_back(std::addressof(it->first), pair.second);
+                } else if (keep_last) {
+                    // later occurrence of this key -> override value
+                    range.pairs[it->second].second = pair.second;
+                }
+            }
+            return range;
+        }
+
+        // whitespace characters separating the keys and values in a hints file
+        static constexpr std::string_view whitespace = " \t\r\v\f";
+        /*
+         * @brief Removes leading and trailing whitespace from @p str.
+         * @param[in] str the string to trim
+         * @return the trimmed string
+         */
+        static std::string_view trim(std::string_view str) noexcept {
+            const std::size_t first = str.find_first_not_of(whitespace);
+            if (first == std::string_view::npos) return std::string_view{};
+            str.remove_prefix(first);
+            return str.substr(0, str.find_last_not_of(whitespace) + 1);
+        }
+
         /*
          * @brief Tests whether the given @p key already exists in the info object.
          * @param[in] key the @p key to check for
@@ -3113,6 +4305,8 @@ namespace mpicxx {
 
         MPI_Info info_;
         bool is_freeable_;
+        bool copy_on_write_ = false;
+        std::shared_ptr<shared_handle> shared_;
     };
 
     // initialize static environment object
@@ -0,0 +1,277 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements an optional recycling pool for [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm)
+ *        handles used by the @ref mpicxx::info class.
+ */
+
+#ifndef MPICXX_INFO_POOL_HPP
+#define MPICXX_INFO_POOL_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <mpi.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace mpicxx {
+
+    /**
+     * @brief Statistics of the @ref mpicxx::info_pool.
+     * @details The statistics are only collected while the pool is enabled.
+     */
+    struct info_pool_statistics {
+        /// Number of handles served from the pool.
+        std::size_t hits = 0;
+        /// Number of handles newly created because the pool was empty.
+        std::size_t misses = 0;
+        /// Number of released handles parked in the pool.
+        std::size_t parked = 0;
+        /// Number of released handles freed because the pool was full.
+        std::size_t dropped = 0;
+
+        /**
+         * @brief Returns the fraction of handle requests served from the pool.
+         * @return the hit rate in the range `[0.0, 1.0]` (`0.0` if no handle has been requested yet)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        double hit_rate() const noexcept {
+            const std::size_t requests = hits + misses;
+            return requests == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(requests);
+        }
+    };
+
+
+    namespace detail {
+
+        /// The mutex guarding the info pool.
+        inline std::mutex info_pool_mutex;
+        /// The parked (empty) MPI_Info handles.
+        inline std::vector<MPI_Info> info_pool_handles;
+        /// The maximum number of parked MPI_Info handles (0 means the pool is disabled); checked without locking the mutex.
+        inline std::atomic<std::size_t> info_pool_capacity = 0;
+        /// The statistics of the info pool.
+        inline info_pool_statistics info_pool_stats;
+        /// `true` if the callback freeing all parked handles during MPI_Finalize has already been registered.
+        inline bool info_pool_finalize_registered = false;
+
+        /**
+         * @brief Frees all parked handles and disables the pool. Called at the beginning of
+         *        [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) (attribute delete callback on
+         *        [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)).
+         * @details Also frees the keyval the callback is attached to.
+         * @return `MPI_SUCCESS`
+         */
+        inline int info_pool_delete_fn([[maybe_unused]] MPI_Comm comm, int comm_key_val,
+                                       [[maybe_unused]] void* attribute_val, [[maybe_unused]] void* extra_state)
+        {
+            std::scoped_lock lock(info_pool_mutex);
+            for (MPI_Info& handle : info_pool_handles) {
+                MPI_Info_free(&handle);
+            }
+            info_pool_handles.clear();
+            info_pool_handles.shrink_to_fit();
+            info_pool_capacity.store(0, std::memory_order_release);
+            info_pool_finalize_registered = false;
+            MPI_Comm_free_keyval(&comm_key_val);
+            return MPI_SUCCESS;
+        }
+
+    }
+
+
+    /**
+     * @brief Optional recycling pool for [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) handles.
+     * @details If enabled (i.e. the capacity is greater than 0), freeable @ref mpicxx::info objects don't free their
+     *          [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) handle on destruction. Instead, the handle gets
+     *          cleared and parked in the pool (if it isn't already full). Newly constructed info objects are served from the pool, avoiding
+     *          calls to [*MPI_Info_create*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). \n
+     *          All parked handles are freed at the beginning of
+     *          [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm), which also disables the pool.
+     *
+     *          The pool is disabled by default and all functions are thread safe. While the pool is disabled, acquiring and releasing a
+     *          handle doesn't lock any mutex.
+     */
+    class info_pool {
+    public:
+        /// Unsigned integer type.
+        using size_type = std::size_t;
+
+        /**
+         * @brief Sets the maximum number of parked handles to @p capacity. A capacity of `0` disables the pool.
+         * @details If the new capacity is less than the number of currently parked handles, the surplus handles are freed.
+         * @param[in] capacity the new capacity
+         *
+         * @pre If @p capacity is greater than 0, the MPI environment **must** be initialized.
+         *
+         * @calls{
+         * int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state);    // at most once
+         * int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);    // at most once
+         * int MPI_Info_free(MPI_info *info);                                              // at most 'this->size()' times
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        static void set_capacity(const size_type capacity) {
+            mpicxx::ensure_initialized();
+
+            std::scoped_lock lock(detail::info_pool_mutex);
+            // register the callback freeing all parked handles during MPI_Finalize
+            if (capacity > 0 && !detail::info_pool_finalize_registered) {
+                int comm_keyval;
+                MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &detail::info_pool_delete_fn, &comm_keyval, nullptr);
+                MPI_Comm_set_attr(MPI_COMM_SELF, comm_keyval, nullptr);
+                detail::info_pool_finalize_registered = true;
+            }
+            // free surplus handles
+            while (detail::info_pool_handles.size() > capacity) {
+                MPI_Info_free(&detail::info_pool_handles.back());
+                detail::info_pool_handles.pop_back();
+            }
+            // parking a handle must not allocate (it is called from the destructor of an info object)
+            detail::info_pool_handles.reserve(capacity);
+            detail::info_pool_capacity.store(capacity, std::memory_order_release);
+        }
+        /**
+         * @brief Returns the maximum number of parked handles.
+         * @return the capacity (`0` if the pool is disabled)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        static size_type capacity() noexcept {
+            return detail::info_pool_capacity.load(std::memory_order_acquire);
+        }
+        /**
+         * @brief Returns the number of currently parked handles.
+         * @return the number of parked handles
+         * @nodiscard
+         */
+        [[nodiscard]]
+        static size_type size() {
+            std::scoped_lock lock(detail::info_pool_mutex);
+            return detail::info_pool_handles.size();
+        }
+        /**
+         * @brief Returns the current statistics of the pool.
+         * @return the statistics (see @ref mpicxx::info_pool_statistics)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        static info_pool_statistics statistics() {
+            std::scoped_lock lock(detail::info_pool_mutex);
+            return detail::info_pool_stats;
+        }
+        /**
+         * @brief Resets all statistics to `0`.
+         */
+        static void reset_statistics() {
+            std::scoped_lock lock(detail::info_pool_mutex);
+            detail::info_pool_stats = info_pool_statistics{};
+        }
+        /**
+         * @brief Frees all parked handles (without changing the capacity).
+         *
+         * @calls{ int MPI_Info_free(MPI_info *info);    // exactly 'this->size()' times }
+         */
+        static void clear() {
+            std::scoped_lock lock(detail::info_pool_mutex);
+            for (MPI_Info& handle : detail::info_pool_handles) {
+                MPI_Info_free(&handle);
+            }
+            detail::info_pool_handles.clear();
+        }
+
+        /**
+         * @brief Returns an empty [*MPI_Info*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) handle, either from the pool
+         *        or newly created.
+         * @return the empty handle
+         * @nodiscard
+         *
+         * @calls{
+         * int MPI_Info_create(MPI_Info *info);    // at most once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        [[nodiscard]]
+        static MPI_Info acquire() {
+            mpicxx::ensure_initialized();
+
+            // the pool is disabled -> don't lock the mutex
+            if (detail::info_pool_capacity.load(std::memory_order_acquire) > 0) {
+                std::scoped_lock lock(detail::info_pool_mutex);
+                if (!detail::info_pool_handles.empty()) {
+                    const MPI_Info handle = detail::info_pool_handles.back();
+                    detail::info_pool_handles.pop_back();
+                    ++detail::info_pool_stats.hits;
+                    return handle;
+                }
+                ++detail::info_pool_stats.misses;
+            }
+            MPI_Info handle;
+            MPI_Info_create(&handle);
+            return handle;
+        }
+        /**
+         * @brief Clears and parks @p handle in the pool or frees it, if the pool is full or disabled.
+         * @param[inout] handle the handle to release; refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm)
+         *                      afterwards
+         *
+         * @pre @p handle **must not** refer to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) or
+         *      [*MPI_INFO_ENV*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm).
+         *
+         * @assert_precondition{ If @p handle refers to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm)
+         *                       or [*MPI_INFO_ENV*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm). }
+         *
+         * @calls{
+         * int MPI_Info_get_nkeys(MPI_Info info, int *nkeys);            // at most once
+         * int MPI_Info_get_nthkey(MPI_Info info, int n, char *key);     // at most 'nkeys' times
+         * int MPI_Info_delete(MPI_Info info, const char *key);          // at most 'nkeys' times
+         * int MPI_Info_free(MPI_info *info);                            // at most once
+         * }
+         */
+        static void release(MPI_Info& handle) {
+            MPICXX_ASSERT_PRECONDITION(handle != MPI_INFO_NULL, "Attempt to release a 'MPI_INFO_NULL' object!");
+            MPICXX_ASSERT_PRECONDITION(handle != MPI_INFO_ENV, "Attempt to release a 'MPI_INFO_ENV' object!");
+
+            // the pool is disabled -> don't lock the mutex
+            if (detail::info_pool_capacity.load(std::memory_order_acquire) == 0) {
+                MPI_Info_free(&handle);
+                return;
+            }
+
+            std::unique_lock lock(detail::info_pool_mutex);
+            if (detail::info_pool_handles.size() < detail::info_pool_capacity.load(std::memory_order_relaxed)) {
+                lock.unlock();
+                // clear the handle (deleting the keys in reverse order doesn't change the position of the remaining keys)
+                int nkeys;
+                MPI_Info_get_nkeys(handle, &nkeys);
+                char key[MPI_MAX_INFO_KEY];
+                for (int i = nkeys - 1; i >= 0; --i) {
+                    MPI_Info_get_nthkey(handle, i, key);
+                    MPI_Info_delete(handle, key);
+                }
+                // park the handle (if the pool didn't get full in the meantime)
+                lock.lock();
+                if (detail::info_pool_handles.size() < detail::info_pool_capacity.load(std::memory_order_relaxed)) {
+                    detail::info_pool_handles.push_back(handle);
+                    ++detail::info_pool_stats.parked;
+                    handle = MPI_INFO_NULL;
+                    return;
+                }
+            }
+            ++detail::info_pool_stats.dropped;
+            lock.unlock();
+            MPI_Info_free(&handle);
+        }
+    };
+
+}
+
+#endif // MPICXX_INFO_POOL_HPP
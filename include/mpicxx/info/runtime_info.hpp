@@ -12,46 +12,162 @@
 
 #include <mpi.h>
 
+#include <atomic>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 
 namespace mpicxx {
 
+    /**
+     * @brief Process-wide cache of runtime information which doesn't change during the lifetime of the MPI environment.
+     * @details Filled once by @ref mpicxx::runtime_info() (called by @ref mpicxx::init()) and invalidated at the beginning of
+     *          [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm).
+     */
+    struct runtime_info_cache {
+        /// The maximum possible number of processes (see @ref mpicxx::universe_size()).
+        std::optional<int> universe_size;
+        /// The name of the processor this code is running on (see @ref mpicxx::processor_name()).
+        std::string processor_name;
+        /// The size of [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+        int world_size;
+        /// The rank of this process in [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+        int world_rank;
+        /// The major version of the used MPI standard.
+        int mpi_version_major;
+        /// The minor version of the used MPI standard.
+        int mpi_version_minor;
+        /// The version of the used MPI library (library specific implementation defined).
+        std::string mpi_library_version;
+    };
+
+
+    namespace detail {
+
+        /// The mutex guarding the filling of the runtime info cache.
+        inline std::mutex runtime_info_mutex;
+        /// The cached runtime information.
+        inline std::optional<runtime_info_cache> runtime_info_data;
+        /// `true` if the runtime info cache is currently filled.
+        inline std::atomic<bool> runtime_info_valid = false;
+        /// Invoked by @ref mpicxx::runtime_info() before filling the cache (used to perform a deferred initialization, see
+        /// @ref mpicxx::defer_init()).
+        inline void (*runtime_info_pre_fill_hook)() = nullptr;
+
+        /**
+         * @brief Invalidates the runtime info cache. Called at the beginning of
+         *        [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) (attribute delete callback on
+         *        [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)).
+         * @return `MPI_SUCCESS`
+         */
+        inline int runtime_info_delete_fn([[maybe_unused]] MPI_Comm comm, [[maybe_unused]] int comm_key_val,
+                                          [[maybe_unused]] void* attribute_val, [[maybe_unused]] void* extra_state)
+        {
+            std::scoped_lock lock(runtime_info_mutex);
+            runtime_info_valid.store(false, std::memory_order_release);
+            runtime_info_data.reset();
+            return MPI_SUCCESS;
+        }
+
+    }
+
+
+    /**
+     * @brief Returns the process-wide @ref mpicxx::runtime_info_cache.
+     * @details The cache is filled on the first call after the MPI environment has been initialized. All subsequent calls (until
+     *          [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)) don't call any MPI function. \n
+     *          If an initialization has been deferred via @ref mpicxx::defer_init(), it is performed before filling the cache.
+     *
+     *    This function is thread safe.
+     * @return the cached runtime information
+     * @nodiscard
+     *
+     * @pre The MPI environment **must** be active (or its initialization **must** have been deferred).
+     *
+     * @calls{
+     * int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag);                                                                                    // at most once
+     * int MPI_Get_processor_name(char *name, int *resultlen);                                                                                                                    // at most once
+     * int MPI_Comm_size(MPI_Comm comm, int *size);                                                                                                                               // at most once
+     * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                                                                                                               // at most once
+     * int MPI_Get_version(int *version, int *subversion);                                                                                                                         // at most once
+     * int MPI_Get_library_version(char *version, int *resultlen);                                                                                                                // at most once
+     * int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state);    // at most once
+     * int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);                                                                                                // at most once
+     * + the MPI functions called by mpicxx::ensure_initialized() (only if an initialization has been deferred)
+     * }
+     */
+    [[nodiscard]]
+    inline const runtime_info_cache& runtime_info() {
+        if (!detail::runtime_info_valid.load(std::memory_order_acquire)) {
+            // perform the deferred initialization (if requested)
+            if (detail::runtime_info_pre_fill_hook != nullptr) {
+                detail::runtime_info_pre_fill_hook();
+            }
+            std::scoped_lock lock(detail::runtime_info_mutex);
+            if (!detail::runtime_info_valid.load(std::memory_order_relaxed)) {
+                runtime_info_cache cache;
+
+                void* ptr;
+                int flag;
+                MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_UNIVERSE_SIZE, &ptr, &flag);
+                if (static_cast<bool>(flag)) {
+                    cache.universe_size = std::make_optional(*reinterpret_cast<int*>(ptr));
+                }
+
+                char name[MPI_MAX_PROCESSOR_NAME];
+                int resultlen;
+                MPI_Get_processor_name(name, &resultlen);
+                cache.processor_name.assign(name, resultlen);
+
+                MPI_Comm_size(MPI_COMM_WORLD, &cache.world_size);
+                MPI_Comm_rank(MPI_COMM_WORLD, &cache.world_rank);
+                MPI_Get_version(&cache.mpi_version_major, &cache.mpi_version_minor);
+
+                char library_version[MPI_MAX_LIBRARY_VERSION_STRING];
+                MPI_Get_library_version(library_version, &resultlen);
+                cache.mpi_library_version.assign(library_version, resultlen);
+
+                detail::runtime_info_data = std::move(cache);
+
+                // invalidate the cache at the beginning of MPI_Finalize
+                int comm_keyval;
+                MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &detail::runtime_info_delete_fn, &comm_keyval, nullptr);
+                MPI_Comm_set_attr(MPI_COMM_SELF, comm_keyval, nullptr);
+
+                detail::runtime_info_valid.store(true, std::memory_order_release);
+            }
+        }
+        return detail::runtime_info_data.value();
+    }
+
     /**
      * @brief Returns the maximum possible number of processes.
+     * @details The value is read from the @ref mpicxx::runtime_info() cache.
      * @return a [`std::optional`](https://en.cppreference.com/w/cpp/utility/optional) containing the maximum possible number of processes
      *         or [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if no value could be retrieved
      * @nodiscard
      *
      * @note It may be possible that less than `universe_size` processes can be spawned if processes are already running.
      *
-     * @calls{ int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag);    // exactly once }
+     * @calls{ int MPI_Comm_get_attr(MPI_Comm comm, int comm_keyval, void *attribute_val, int *flag);    // at most once (if the cache isn't filled yet) }
      */
     [[nodiscard]]
     inline std::optional<int> universe_size() {
-        void* ptr;
-        int flag;
-        MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_UNIVERSE_SIZE, &ptr, &flag);
-        if (static_cast<bool>(flag)) {
-            return std::make_optional(*reinterpret_cast<int*>(ptr));
-        } else {
-            return std::nullopt;
-        }
+        return mpicxx::runtime_info().universe_size;
     }
 
     /**
      * @brief Returns the name of the processor this code is currently running on.
+     * @details The value is read from the @ref mpicxx::runtime_info() cache.
      * @return the name of the processor this code is running on
      * @nodiscard
      *
-     * @calls{ int MPI_Get_processor_name(char *name, int *resultlen);    // exactly once }
+     * @calls{ int MPI_Get_processor_name(char *name, int *resultlen);    // at most once (if the cache isn't filled yet) }
      */
     [[nodiscard]]
     inline std::string processor_name() {
-        char name[MPI_MAX_PROCESSOR_NAME];
-        int resultlen;
-        MPI_Get_processor_name(name, &resultlen);
-        return std::string(name, resultlen);
+        return mpicxx::runtime_info().processor_name;
     }
 
 }
@@ -0,0 +1,294 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a communication proxy allowing arbitrary threads to issue MPI calls which get executed by the main thread, i.e.
+ *        multi-threaded communication on top of @ref mpicxx::thread_support::funneled.
+ */
+
+#ifndef MPICXX_COMMUNICATION_PROXY_HPP
+#define MPICXX_COMMUNICATION_PROXY_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/thread_support.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace mpicxx {
+
+    namespace detail {
+
+        /**
+         * @brief A lock-free, unbounded multi-producer single-consumer queue.
+         * @details Based on the intrusive node-based MPSC queue by Dmitry Vyukov: producers only perform **one** atomic exchange, the
+         *          consumer never blocks producers. Elements pushed by the same producer are popped in the same order.
+         * @tparam T the type of the elements
+         */
+        template <typename T>
+        class mpsc_queue {
+        public:
+            /**
+             * @brief Construct a new empty queue.
+             */
+            mpsc_queue() : head_(new node()), tail_(head_.load(std::memory_order_relaxed)) { }
+            /**
+             * @brief Deleted copy constructor.
+             */
+            mpsc_queue(const mpsc_queue&) = delete;
+            /**
+             * @brief Deleted copy assignment operator.
+             */
+            mpsc_queue& operator=(const mpsc_queue&) = delete;
+            /**
+             * @brief Destruct the queue, i.e. destroys all remaining elements.
+             */
+            ~mpsc_queue() {
+                while (this->pop().has_value()) { }
+                delete tail_;
+            }
+
+            /**
+             * @brief Adds @p value to the queue.
+             * @details May be called concurrently by an arbitrary number of threads.
+             * @param[in] value the element to add
+             */
+            void push(T value) {
+                node* n = new node();
+                n->value.emplace(std::move(value));
+                node* prev = head_.exchange(n, std::memory_order_acq_rel);
+                prev->next.store(n, std::memory_order_release);
+            }
+            /**
+             * @brief Removes the oldest element from the queue.
+             * @details **Must not** be called concurrently.
+             * @return the removed element or [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if the queue is
+             *         (currently) empty
+             * @nodiscard
+             */
+            [[nodiscard]]
+            std::optional<T> pop() {
+                node* next = tail_->next.load(std::memory_order_acquire);
+                if (next == nullptr) {
+                    return std::nullopt;
+                }
+                // the next node becomes the new stub node
+                std::optional<T> value(std::in_place, std::move(*next->value));
+                next->value.reset();
+                delete tail_;
+                tail_ = next;
+                return value;
+            }
+
+        private:
+            /*
+             * @brief A node of the linked list (the stub node doesn't hold a value).
+             */
+            struct node {
+                std::atomic<node*> next = nullptr;
+                std::optional<T> value;
+            };
+
+            std::atomic<node*> head_;
+            node* tail_;
+        };
+
+
+        /*
+         * @brief Type erased base class of all commands submitted to a @ref mpicxx::communication_proxy.
+         */
+        struct proxy_command_base {
+            virtual ~proxy_command_base() = default;
+            virtual void execute() = 0;
+        };
+        /*
+         * @brief Holds the callable @p Func together with the promise receiving its result.
+         * @tparam Func the type of the callable
+         */
+        template <typename Func>
+        struct proxy_command final : proxy_command_base {
+            using result_type = std::invoke_result_t<Func&>;
+
+            explicit proxy_command(Func&& f) : func(std::move(f)) { }
+            void execute() override {
+                try {
+                    if constexpr (std::is_void_v<result_type>) {
+                        std::invoke(func);
+                        promise.set_value();
+                    } else {
+                        promise.set_value(std::invoke(func));
+                    }
+                } catch (...) {
+                    promise.set_exception(std::current_exception());
+                }
+            }
+
+            Func func;
+            std::promise<result_type> promise;
+        };
+
+    }
+
+
+    /**
+     * @brief A communication proxy enabling multi-threaded communication on top of @ref mpicxx::thread_support::funneled.
+     * @details Arbitrary threads submit callables (containing their MPI calls) via @ref submit() and receive a
+     *          [`std::future`](https://en.cppreference.com/w/cpp/thread/future) for the result. The callables are stored in a lock-free
+     *          multi-producer single-consumer queue and executed by the main thread (the thread that called @ref mpicxx::init(), see
+     *          @ref mpicxx::is_main_thread()) in @ref progress() or @ref run_until(). Therefore, no MPI call is ever issued by another
+     *          thread and the locking overhead of @ref mpicxx::thread_support::multiple is avoided. \n
+     *          Callables submitted by the same thread are executed in the order they were submitted. Callables submitted by the main thread
+     *          itself are executed immediately. \n
+     *          The proxy **must** outlive all threads submitting callables.
+     *
+     *    Example: @snippet examples/startup/communication_proxy.cpp communication proxy
+     */
+    class communication_proxy {
+    public:
+        /// Unsigned integer type.
+        using size_type = std::size_t;
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                        constructors and destructor                                         //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name constructors and destructor
+        ///@{
+        /**
+         * @brief Construct a new communication proxy owned by the calling (main) thread.
+         *
+         * @pre The calling thread **must** be the main thread.
+         *
+         * @assert_precondition{ If the calling thread isn't the main thread. }
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support is less than
+         *         @ref mpicxx::thread_support::funneled
+         *
+         * @calls{
+         * int MPI_Is_thread_main(int *flag);    // at most once
+         * int MPI_Query_thread(int *provided);  // exactly once
+         * }
+         */
+        communication_proxy() : main_thread_(std::this_thread::get_id()) {
+            MPICXX_ASSERT_PRECONDITION(mpicxx::is_main_thread(), "A communication_proxy must be created by the main thread!");
+
+            mpicxx::require_thread_support(thread_support::funneled);
+        }
+        /**
+         * @brief Deleted copy constructor.
+         */
+        communication_proxy(const communication_proxy&) = delete;
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        communication_proxy& operator=(const communication_proxy&) = delete;
+        /**
+         * @brief Destruct the communication proxy, i.e. executes all still pending callables (if the MPI environment is still active).
+         * @details Otherwise, the futures of the pending callables report a
+         *          [`std::future_error`](https://en.cppreference.com/w/cpp/thread/future_error) (broken promise).
+         */
+        ~communication_proxy() {
+            if (mpicxx::active()) {
+                [[maybe_unused]] const size_type executed = this->progress();
+            }
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                 submission                                                 //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name submission
+        ///@{
+        /**
+         * @brief Submits the callable @p func to be executed by the main thread.
+         * @details May be called concurrently by an arbitrary number of threads. Submitting never blocks. \n
+         *          If called by the main thread itself, @p func is executed immediately.
+         * @tparam Func the type of the callable (may be move-only)
+         * @param[in] func the callable
+         * @return the future receiving the result (or the exception) of @p func
+         * @nodiscard
+         */
+        template <typename Func>
+        [[nodiscard]]
+        std::future<std::invoke_result_t<std::decay_t<Func>&>> submit(Func&& func) requires std::invocable<std::decay_t<Func>&> {
+            auto command = std::make_unique<detail::proxy_command<std::decay_t<Func>>>(std::decay_t<Func>(std::forward<Func>(func)));
+            auto future = command->promise.get_future();
+            if (std::this_thread::get_id() == main_thread_) {
+                command->execute();
+            } else {
+                queue_.push(std::move(command));
+            }
+            return future;
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                 execution                                                  //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name execution
+        ///@{
+        /**
+         * @brief Executes all currently pending callables.
+         * @return the number of executed callables
+         *
+         * @pre The calling thread **must** be the main thread.
+         *
+         * @assert_precondition{ If the calling thread isn't the main thread. }
+         */
+        size_type progress() {
+            MPICXX_ASSERT_PRECONDITION(std::this_thread::get_id() == main_thread_,
+                    "Only the main thread may execute the callables submitted to a communication_proxy!");
+
+            size_type executed = 0;
+            while (std::optional<std::unique_ptr<detail::proxy_command_base>> command = queue_.pop()) {
+                command.value()->execute();
+                ++executed;
+            }
+            return executed;
+        }
+        /**
+         * @brief Executes the submitted callables until @p pred returns `true`.
+         * @details @p pred is checked before each round of @ref progress(). If no callable is pending, the main thread yields.
+         * @tparam Predicate the type of the predicate
+         * @param[in] pred the predicate
+         * @return the number of executed callables
+         *
+         * @pre The calling thread **must** be the main thread.
+         *
+         * @assert_precondition{ If the calling thread isn't the main thread. }
+         */
+        template <typename Predicate>
+        size_type run_until(Predicate&& pred) requires std::predicate<Predicate&> {
+            size_type executed = 0;
+            while (!std::invoke(pred)) {
+                const size_type round = this->progress();
+                if (round == 0) {
+                    std::this_thread::yield();
+                }
+                executed += round;
+            }
+            return executed;
+        }
+        ///@}
+
+    private:
+        const std::thread::id main_thread_;
+        detail::mpsc_queue<std::unique_ptr<detail::proxy_command_base>> queue_;
+    };
+
+}
+
+#endif // MPICXX_COMMUNICATION_PROXY_HPP
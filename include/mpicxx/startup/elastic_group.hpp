@@ -0,0 +1,361 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a group of spawning processes and their spawned workers which can grow and shrink at runtime while maintaining
+ *        one intracommunicator spanning all of its members.
+ */
+
+#ifndef MPICXX_ELASTIC_GROUP_HPP
+#define MPICXX_ELASTIC_GROUP_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/single_spawner.hpp>
+
+#include <mpi.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace mpicxx {
+
+    /**
+     * @brief A group of spawning processes (the *parents*) and all of their currently live spawned processes (the *workers*).
+     * @details The group maintains **one** intracommunicator spanning all of its members: the parents are ordered first (in the order of
+     *          the communicator of the @ref mpicxx::single_spawner used to create the group), followed by the workers in the order
+     *          they joined the group. \n
+     *          @ref grow(const int) spawns additional workers (using the @ref mpicxx::single_spawner as template) and merges them into
+     *          the group. @ref shrink(const int) cooperatively releases the most recently spawned workers by rebuilding the
+     *          communicator via [*MPI_Comm_split*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node156.htm). Both are collective
+     *          over **all** members of the group, i.e. the workers must take part in every resizing (e.g. by following instructions
+     *          broadcast by the parent with rank `0`). \n
+     *          The spawned processes join the group via @ref join() (after receiving their payload via @ref mpicxx::receive_payload()
+     *          if any has been set). \n
+     *          The communicator is freed on destruction (if the MPI environment hasn't been finalized yet).
+     *
+     *    Example: @snippet examples/startup/elastic_group.cpp elastic group
+     */
+    class elastic_group {
+    public:
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                        constructors and destructor                                         //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name constructors and destructor
+        ///@{
+        /**
+         * @brief Creates a new group containing all processes of the communicator of @p spawner (without any workers).
+         * @details Collective over the communicator of @p spawner. @p spawner is used as template for all subsequent
+         *          @ref grow(const int) calls (only the number of processes, the root and the communicator get replaced).
+         * @param[in] spawner the spawner used as template to spawn the workers
+         *
+         * @pre The communicator of @p spawner **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the communicator of @p spawner is [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @calls{
+         * int MPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm);    // exactly once
+         * int MPI_Comm_size(MPI_Comm comm, int *size);          // exactly once
+         * }
+         */
+        explicit elastic_group(single_spawner spawner) : spawner_(std::move(spawner)) {
+            mpicxx::ensure_initialized();
+            MPICXX_ASSERT_PRECONDITION(spawner_->communicator() != MPI_COMM_NULL, "Can't create an elastic_group from the null communicator!");
+
+            MPI_Comm_dup(spawner_->communicator(), &comm_);
+            MPI_Comm_size(comm_, &parents_);
+        }
+        /**
+         * @brief Move constructor. Transfers the ownership of the communicator.
+         * @param[inout] other the moved-from object (not @ref active() afterwards)
+         */
+        elastic_group(elastic_group&& other) noexcept
+            : comm_(std::exchange(other.comm_, MPI_COMM_NULL)), parents_(std::exchange(other.parents_, 0)),
+              spawner_(std::exchange(other.spawner_, std::nullopt)) { }
+        /**
+         * @brief Move assignment operator. Frees the currently owned communicator and transfers the ownership of @p rhs's communicator.
+         * @param[inout] rhs the moved-from object (not @ref active() afterwards)
+         * @return `*this`
+         *
+         * @calls{ int MPI_Comm_free(MPI_Comm *comm);    // at most once }
+         */
+        elastic_group& operator=(elastic_group&& rhs) noexcept {
+            if (this != std::addressof(rhs)) {
+                this->free_communicator();
+                comm_ = std::exchange(rhs.comm_, MPI_COMM_NULL);
+                parents_ = std::exchange(rhs.parents_, 0);
+                spawner_ = std::exchange(rhs.spawner_, std::nullopt);
+            }
+            return *this;
+        }
+        /**
+         * @brief Deleted copy constructor.
+         */
+        elastic_group(const elastic_group&) = delete;
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        elastic_group& operator=(const elastic_group&) = delete;
+        /**
+         * @brief Destructs the @ref mpicxx::elastic_group object, i.e. frees the owned communicator.
+         *
+         * @calls{
+         * int MPI_Finalized(int *flag);         // at most once
+         * int MPI_Comm_free(MPI_Comm *comm);    // at most once
+         * }
+         */
+        ~elastic_group() {
+            this->free_communicator();
+        }
+
+        /**
+         * @brief Joins the group whose @ref grow(const int) spawned the current process.
+         * @details Collective over **all** members of the group and **all** processes spawned by the same @ref grow(const int). \n
+         *          The intercommunicator to the parent processes gets freed, i.e.
+         *          [*MPI_Comm_get_parent*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node241.htm) returns
+         *          [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm) afterwards. Therefore, the payload
+         *          (if any has been set) **must** be received **before** calling this function.
+         * @return the joined group
+         * @nodiscard
+         *
+         * @pre The current process **must** have been spawned by @ref grow(const int).
+         *
+         * @assert_precondition{ If the current process hasn't been spawned. }
+         *
+         * @calls{
+         * int MPI_Comm_get_parent(MPI_Comm *parent);                                                 // exactly once
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);             // exactly once
+         * int MPI_Comm_free(MPI_Comm *comm);                                                         // exactly once
+         * int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);    // exactly once
+         * }
+         */
+        [[nodiscard]]
+        static elastic_group join() {
+            mpicxx::ensure_initialized();
+
+            MPI_Comm parent;
+            MPI_Comm_get_parent(&parent);
+            MPICXX_ASSERT_PRECONDITION(parent != MPI_COMM_NULL, "Attempt to join an elastic_group without a parent process!");
+
+            // the spawned processes are ordered after all current members of the group
+            elastic_group group;
+            MPI_Intercomm_merge(parent, 1, &group.comm_);
+            MPI_Comm_free(&parent);
+            MPI_Bcast(&group.parents_, 1, MPI_INT, 0, group.comm_);
+            return group;
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                  resizing                                                  //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name resizing
+        ///@{
+        /**
+         * @brief Spawns @p n additional workers and merges them into the group.
+         * @details Collective over **all** members of the group (parents **and** workers). The parent with rank `0` acts as root of the
+         *          spawn, i.e. only its spawn options are significant. The new workers **must** call @ref join(). \n
+         *          The already running workers are **not** affected, the new workers are ordered after them.
+         * @param[in] n the number of workers to spawn
+         *
+         * @pre The group **must** be @ref active().
+         * @pre @p n **must** be greater than `0`.
+         *
+         * @assert_precondition{ If the group isn't active. \n
+         *                       If @p n is less or equal than `0`. }
+         *
+         * @calls{
+         * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);                                    // at most 'n' times (only if a payload has been set)
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);                                                                             // exactly once
+         * int MPI_Comm_free(MPI_Comm *comm);                                                                                                                         // exactly twice
+         * int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);                                                                    // exactly once
+         * }
+         */
+        void grow(const int n) {
+            MPICXX_ASSERT_PRECONDITION(this->active(), "Attempt to grow an inactive elastic_group!");
+            MPICXX_ASSERT_PRECONDITION(n > 0, "Attempt to grow an elastic_group by {} workers (must be greater than 0)!", n);
+
+            MPI_Comm intercomm;
+            if (spawner_.has_value()) {
+                // a parent -> use the template (only significant at the root)
+                single_spawner spawner = spawner_.value();
+                spawner.set_maxprocs(n).set_root(0).set_communicator(comm_);
+                intercomm = spawner.spawn().intercommunicator();
+            } else {
+                // a worker -> the spawn options are ignored
+                MPI_Comm_spawn("", MPI_ARGV_NULL, n, MPI_INFO_NULL, 0, comm_, &intercomm, MPI_ERRCODES_IGNORE);
+            }
+
+            // replace the communicator by one additionally containing the new workers
+            MPI_Comm merged;
+            MPI_Intercomm_merge(intercomm, 0, &merged);
+            MPI_Comm_free(&intercomm);
+            MPI_Comm_free(&comm_);
+            comm_ = merged;
+            MPI_Bcast(&parents_, 1, MPI_INT, 0, comm_);
+        }
+        /**
+         * @brief Cooperatively releases the @p n most recently spawned workers from the group.
+         * @details Collective over **all** members of the group (parents **and** workers). The communicator gets rebuilt via
+         *          [*MPI_Comm_split*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node156.htm), the remaining members keep their
+         *          relative order. \n
+         *          The released workers are no longer @ref active() and should leave their work loop and finalize the MPI environment.
+         *          Note that, depending on the MPI implementation, finalizing may wait until the other processes spawned by the same
+         *          @ref grow(const int) call (and their parents) finalize as well.
+         * @param[in] n the number of workers to release
+         * @return `true` if the calling process is still a member of the group, `false` if it has been released
+         *
+         * @pre The group **must** be @ref active().
+         * @pre @p n **must** be greater than `0` and less or equal than @ref number_of_workers().
+         *
+         * @assert_precondition{ If the group isn't active. \n
+         *                       If @p n falls outside the valid range. }
+         *
+         * @calls{
+         * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                 // exactly once
+         * int MPI_Comm_size(MPI_Comm comm, int *size);                                 // at least once
+         * int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm);    // exactly once
+         * int MPI_Comm_free(MPI_Comm *comm);                                           // exactly once
+         * }
+         */
+        bool shrink(const int n) {
+            MPICXX_ASSERT_PRECONDITION(this->active(), "Attempt to shrink an inactive elastic_group!");
+            MPICXX_ASSERT_PRECONDITION(0 < n && n <= this->number_of_workers(),
+                    "Attempt to release {} workers, which falls outside the valid range (0, {}]!", n, this->number_of_workers());
+
+            const int rank = this->rank();
+            const bool leave = rank >= this->size() - n;
+
+            MPI_Comm remaining;
+            MPI_Comm_split(comm_, leave ? MPI_UNDEFINED : 0, rank, &remaining);
+            MPI_Comm_free(&comm_);
+            comm_ = remaining;
+            if (leave) {
+                parents_ = 0;
+            }
+            return !leave;
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                   getter                                                   //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name getter
+        ///@{
+        /**
+         * @brief Returns whether the calling process is (still) a member of the group.
+         * @return `true` if the calling process is a member, `false` if it has been released via @ref shrink(const int) or the group
+         *         has been moved-from
+         * @nodiscard
+         */
+        [[nodiscard]]
+        bool active() const noexcept { return comm_ != MPI_COMM_NULL; }
+        /**
+         * @brief Returns the intracommunicator spanning all members of the group (without transferring the ownership).
+         * @details The communicator gets replaced by every @ref grow(const int) and @ref shrink(const int) call.
+         * @return the intracommunicator ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm) if the
+         *         group isn't @ref active())
+         * @nodiscard
+         */
+        [[nodiscard]]
+        MPI_Comm communicator() const noexcept { return comm_; }
+        /**
+         * @brief Returns the rank of the calling process in the group.
+         * @return the rank
+         * @nodiscard
+         *
+         * @pre The group **must** be @ref active().
+         *
+         * @assert_precondition{ If the group isn't active. }
+         *
+         * @calls{ int MPI_Comm_rank(MPI_Comm comm, int *rank);    // exactly once }
+         */
+        [[nodiscard]]
+        int rank() const {
+            MPICXX_ASSERT_PRECONDITION(this->active(), "Attempt to query the rank of an inactive elastic_group!");
+
+            int rank;
+            MPI_Comm_rank(comm_, &rank);
+            return rank;
+        }
+        /**
+         * @brief Returns the number of members (parents and workers) of the group.
+         * @return the size
+         * @nodiscard
+         *
+         * @pre The group **must** be @ref active().
+         *
+         * @assert_precondition{ If the group isn't active. }
+         *
+         * @calls{ int MPI_Comm_size(MPI_Comm comm, int *size);    // exactly once }
+         */
+        [[nodiscard]]
+        int size() const {
+            MPICXX_ASSERT_PRECONDITION(this->active(), "Attempt to query the size of an inactive elastic_group!");
+
+            int size;
+            MPI_Comm_size(comm_, &size);
+            return size;
+        }
+        /**
+         * @brief Returns the number of parents, i.e. the size of the communicator the group has been created from.
+         * @return the number of parents (`0` if the group isn't @ref active())
+         * @nodiscard
+         */
+        [[nodiscard]]
+        int number_of_parents() const noexcept { return parents_; }
+        /**
+         * @brief Returns the number of currently live workers.
+         * @return the number of workers
+         * @nodiscard
+         *
+         * @pre The group **must** be @ref active().
+         *
+         * @assert_precondition{ If the group isn't active. }
+         *
+         * @calls{ int MPI_Comm_size(MPI_Comm comm, int *size);    // exactly once }
+         */
+        [[nodiscard]]
+        int number_of_workers() const { return this->size() - parents_; }
+        /**
+         * @brief Returns whether the calling process is a worker, i.e. it has joined the group via @ref join().
+         * @return `true` if the calling process is a worker, `false` if it is a parent
+         * @nodiscard
+         */
+        [[nodiscard]]
+        bool is_worker() const noexcept { return !spawner_.has_value(); }
+        ///@}
+
+    private:
+        /*
+         * @brief Construct an empty group (used by @ref join()).
+         */
+        elastic_group() = default;
+
+        /*
+         * @brief Frees the owned communicator (if any and if the MPI environment hasn't been finalized yet).
+         */
+        void free_communicator() noexcept {
+            if (comm_ != MPI_COMM_NULL) {
+                int flag;
+                MPI_Finalized(&flag);
+                if (!static_cast<bool>(flag)) {
+                    MPI_Comm_free(&comm_);
+                }
+                comm_ = MPI_COMM_NULL;
+            }
+        }
+
+        MPI_Comm comm_ = MPI_COMM_NULL;
+        int parents_ = 0;
+        std::optional<single_spawner> spawner_;
+    };
+
+}
+
+#endif // MPICXX_ELASTIC_GROUP_HPP
@@ -0,0 +1,169 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a value type wrapping an MPI error code and the structured aggregation of the error codes returned by a spawn.
+ */
+
+#ifndef MPICXX_ERRCODE_HPP
+#define MPICXX_ERRCODE_HPP
+
+#include <mpi.h>
+
+#include <compare>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace mpicxx {
+
+    /**
+     * @brief A value type wrapping an MPI error code, e.g. one of the error codes returned by
+     *        [*MPI_Comm_spawn*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node237.htm).
+     * @details The special value `-1` denotes an error code which hasn't been set by the MPI library.
+     */
+    class errcode {
+    public:
+        /**
+         * @brief Construct a new errcode representing [*MPI_SUCCESS*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node222.htm).
+         */
+        constexpr errcode() noexcept = default;
+        /**
+         * @brief Construct a new errcode wrapping the MPI error code @p code.
+         * @param[in] code the MPI error code
+         */
+        constexpr explicit errcode(const int code) noexcept : code_(code) { }
+
+        /**
+         * @brief Returns the wrapped MPI error code.
+         * @return the MPI error code
+         * @nodiscard
+         */
+        [[nodiscard]]
+        constexpr int value() const noexcept { return code_; }
+        /**
+         * @brief Check whether the error code denotes [*MPI_SUCCESS*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node222.htm).
+         * @return `true` if no error occurred, `false` otherwise
+         * @nodiscard
+         */
+        [[nodiscard]]
+        constexpr bool success() const noexcept { return code_ == MPI_SUCCESS; }
+        /**
+         * @brief Returns the error class of the error code.
+         * @return the error class (`-1` if the error code hasn't been set by the MPI library)
+         * @nodiscard
+         *
+         * @calls{ int MPI_Error_class(int errorcode, int *errorclass);    // at most once }
+         */
+        [[nodiscard]]
+        int error_class() const {
+            if (code_ == -1) {
+                return -1;
+            }
+            int error_class;
+            MPI_Error_class(code_, &error_class);
+            return error_class;
+        }
+        /**
+         * @brief Returns the error string of the error code.
+         * @return the error string
+         * @nodiscard
+         *
+         * @calls{ int MPI_Error_string(int errorcode, char *string, int *resultlen);    // at most once }
+         */
+        [[nodiscard]]
+        std::string message() const {
+            if (code_ == -1) {
+                return std::string("Failed to retrieve error string");
+            }
+            char error_string[MPI_MAX_ERROR_STRING];
+            int resultlen;
+            MPI_Error_string(code_, error_string, &resultlen);
+            return std::string(error_string, resultlen);
+        }
+
+        /**
+         * @brief Compares two errcodes by their wrapped MPI error codes.
+         * @param[in] lhs the first errcode
+         * @param[in] rhs the second errcode
+         * @return the three-way comparison result
+         * @nodiscard
+         */
+        [[nodiscard]]
+        friend constexpr auto operator<=>(const errcode lhs, const errcode rhs) noexcept = default;
+        /**
+         * @brief Stream-insertion operator overload for the @ref mpicxx::errcode class. Prints the wrapped MPI error code.
+         * @param[inout] out an output stream
+         * @param[in] err the errcode
+         * @return the output stream
+         */
+        friend std::ostream& operator<<(std::ostream& out, const errcode err) {
+            out << err.code_;
+            return out;
+        }
+
+    private:
+        int code_ = MPI_SUCCESS;
+    };
+
+
+    /**
+     * @brief The aggregated information about **one** distinct error code returned by a spawn.
+     */
+    struct errcode_summary {
+        /// The error code.
+        errcode code;
+        /// How often @ref code occurred.
+        std::size_t count;
+        /// The index of the first process for which @ref code occurred.
+        std::size_t first_index;
+        /// The error string of @ref code (retrieved **once** per distinct error code).
+        std::string message;
+    };
+
+    /**
+     * @brief Aggregates all error codes in @p errcodes which don't denote
+     *        [*MPI_SUCCESS*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node222.htm).
+     * @details Performs **one** linear pass over @p errcodes. Since the number of distinct error codes is typically tiny, they are kept
+     *          in a flat array (ordered by their first occurrence) instead of a node based container.
+     * @param[in] errcodes the error codes (one for each process)
+     * @return the summary of each distinct error code (empty if no error occurred)
+     * @nodiscard
+     *
+     * @calls{ int MPI_Error_string(int errorcode, char *string, int *resultlen);    // exactly once per distinct error code }
+     */
+    [[nodiscard]]
+    inline std::vector<errcode_summary> summarize_errcodes(const std::span<const int> errcodes) {
+        std::vector<errcode_summary> summary;
+        for (std::size_t i = 0; i < errcodes.size(); ++i) {
+            if (errcodes[i] == MPI_SUCCESS) {
+                continue;
+            }
+            const errcode err(errcodes[i]);
+            bool found = false;
+            for (errcode_summary& entry : summary) {
+                if (entry.code == err) {
+                    ++entry.count;
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                summary.push_back(errcode_summary{ err, 1, i, std::string{} });
+            }
+        }
+
+        // retrieve the error string exactly once per distinct error code
+        for (errcode_summary& entry : summary) {
+            entry.message = entry.code.message();
+        }
+        return summary;
+    }
+
+}
+
+#endif // MPICXX_ERRCODE_HPP
@@ -11,9 +11,19 @@
 #define MPICXX_FINALIZATION_HPP
 
 #include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace mpicxx {
 
     /// @name finalization of the MPI environment
@@ -74,67 +84,208 @@ namespace mpicxx {
     }
 
     namespace detail {
-        // callback functions type
+
+        /// The type of a (function pointer) callback function.
         using atfinalize_callback_t = void (*)(void);
-        // registered callback functions
-        inline std::array<atfinalize_callback_t, MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS> atfinalize_lookup_callbacks;
-        // number of registered callback functions
-        inline std::size_t atfinalize_idx = 0;
 
         /*
-         * @brief Calls a specific callback function (previously registered).
+         * @brief Type erased base class of all registered callbacks (allows move-only callables with captured state).
+         */
+        struct atfinalize_callback_base {
+            virtual ~atfinalize_callback_base() = default;
+            virtual void invoke() = 0;
+        };
+        /*
+         * @brief Holds the callable @p Func.
+         * @tparam Func the type of the callable
+         */
+        template <typename Func>
+        struct atfinalize_callback final : atfinalize_callback_base {
+            explicit atfinalize_callback(Func&& f) : func(std::move(f)) { }
+            explicit atfinalize_callback(const Func& f) : func(f) { }
+            void invoke() override { std::invoke(func); }
+
+            Func func;
+        };
+
+        /**
+         * @brief The registry of all callbacks invoked directly before
+         *        [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm).
+         * @details The callbacks are invoked in descending order of their priority. Callbacks with the same priority are invoked in
+         *          reverse order in which they were added. \n
+         *          All functions are thread safe.
+         */
+        class atfinalize_registry {
+        public:
+            /// The type of the priority of a callback.
+            using priority_type = int;
+            /// Unsigned integer type.
+            using size_type = std::size_t;
+
+            /**
+             * @brief Adds the callable @p func with the priority @p priority.
+             * @tparam Func the type of the callable
+             * @param[in] func the callable
+             * @param[in] priority the priority
+             */
+            template <typename Func>
+            void add(Func&& func, const priority_type priority) {
+                auto callback = std::make_unique<atfinalize_callback<std::decay_t<Func>>>(std::forward<Func>(func));
+                std::scoped_lock lock(mutex_);
+                entries_.push_back(entry{ priority, std::move(callback) });
+            }
+            /**
+             * @brief Invokes and removes all registered callbacks.
+             * @details Callbacks added while invoking the callbacks are invoked afterwards.
+             */
+            void invoke() {
+                for (;;) {
+                    std::vector<entry> entries;
+                    {
+                        std::scoped_lock lock(mutex_);
+                        entries.swap(entries_);
+                    }
+                    if (entries.empty()) {
+                        return;
+                    }
+                    // reverse order of registration, stable w.r.t. the descending priorities
+                    std::reverse(entries.begin(), entries.end());
+                    std::stable_sort(entries.begin(), entries.end(),
+                            [](const entry& lhs, const entry& rhs) { return lhs.priority > rhs.priority; });
+                    for (entry& e : entries) {
+                        e.callback->invoke();
+                    }
+                }
+            }
+            /**
+             * @brief Returns the number of currently registered callbacks.
+             * @return the number of callbacks
+             * @nodiscard
+             */
+            [[nodiscard]]
+            size_type size() const {
+                std::scoped_lock lock(mutex_);
+                return entries_.size();
+            }
+
+        private:
+            /*
+             * @brief A registered callback together with its priority.
+             */
+            struct entry {
+                priority_type priority;
+                std::unique_ptr<atfinalize_callback_base> callback;
+            };
+
+            mutable std::mutex mutex_;
+            std::vector<entry> entries_;
+        };
+
+        /// The registry of all callbacks registered via @ref mpicxx::atfinalize().
+        inline atfinalize_registry atfinalize_callbacks;
+        /// The mutex guarding the registration of the registry's keyval.
+        inline std::mutex atfinalize_mutex;
+        /// `true` if the keyval invoking the registry during MPI_Finalize has already been registered.
+        inline bool atfinalize_registered = false;
+
+        /*
+         * @brief Invokes all registered callbacks. Called at the beginning of
+         *        [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) (attribute delete callback on
+         *        [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)).
          * @param[in] comm not used
          * @param[in] comm_key_val not used
          * @param[in] attribute_val not used
          * @param[in] extra_state not used
-         * @return always `0`
+         * @return always `MPI_SUCCESS`
          */
         inline int atfinalize_delete_fn([[maybe_unused]] MPI_Comm comm, [[maybe_unused]] int comm_key_val,
                 [[maybe_unused]] void* attribute_val, [[maybe_unused]] void* extra_state)
         {
-            // invoke handler function
-            std::invoke(atfinalize_lookup_callbacks[--atfinalize_idx]);
-            return 0;
+            atfinalize_callbacks.invoke();
+            return MPI_SUCCESS;
+        }
+
+        /*
+         * @brief Registers the **single** keyval whose delete callback invokes the registry (if not already done).
+         *
+         * @calls{
+         * int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state);    // at most once
+         * int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);    // at most once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        inline void atfinalize_register_keyval() {
+            mpicxx::ensure_initialized();
+
+            std::scoped_lock lock(atfinalize_mutex);
+            if (!atfinalize_registered) {
+                int comm_keyval;
+                MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &atfinalize_delete_fn, &comm_keyval, nullptr);
+                MPI_Comm_set_attr(MPI_COMM_SELF, comm_keyval, nullptr);
+                atfinalize_registered = true;
+            }
         }
+
     }
     /**
-     * @brief Registers the callback function @p func (of the type `void (*)void`) to be called directly before
+     * @brief Registers the callable @p func to be called directly before
      *        [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm).
-     * @details Calls all registered functions in reverse order in which they were set. This happens before any other parts of MPI are
-     *          affected, i.e. @ref mpicxx::finalized() will return `false` in any of these callback functions.
+     * @details Calls all registered callables in descending order of their @p priority. Callables with the same priority are called in
+     *          reverse order in which they were set. This happens before any other parts of MPI are affected, i.e.
+     *          @ref mpicxx::finalized() will return `false` in any of these callables.
+     *
+     *    Arbitrary (including move-only) callables with captured state can be registered, e.g. to flush buffers. There is no limit on the
+     *    number of registered callables and only **one** keyval is created for all of them. The callables **must not** throw. \n
+     *    This function is thread safe.
+     * @tparam Func the type of the callable
+     * @param[in] func the callable to be called on normal MPI finalization
+     * @param[in] priority the priority (callables with a higher priority are called first)
+     *
+     * @pre If @p func is convertible to `bool` (e.g. a [`std::function`](https://en.cppreference.com/w/cpp/utility/functional/function)),
+     *      it **must not** be empty.
      *
-     *    The maximum number of registrable callback functions can be set via the [`CMake`](https://cmake.org/) configuration flag
-     *          *MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS* (default: `32`).
+     * @assert_precondition{ If @p func is empty. }
+     *
+     * @calls{
+     * int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state);    // at most once
+     * int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);    // at most once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
+     */
+    template <typename Func>
+    inline void atfinalize(Func&& func, const detail::atfinalize_registry::priority_type priority = 0)
+            requires std::invocable<std::decay_t<Func>&>
+    {
+        if constexpr (std::is_constructible_v<bool, const std::decay_t<Func>&>) {
+            MPICXX_ASSERT_PRECONDITION(static_cast<bool>(func), "The callback function cannot be empty!");
+        }
+
+        detail::atfinalize_callbacks.add(std::forward<Func>(func), priority);
+        detail::atfinalize_register_keyval();
+    }
+    /**
+     * @brief Registers the callback function @p func (of the type `void (*)void`) to be called directly before
+     *        [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm).
+     * @details See the above overload.
      * @param[in] func pointer to a function to be called on normal MPI finalization
-     * @return `0` if the registration succeeded, `1` otherwise
+     * @param[in] priority the priority (callback functions with a higher priority are called first)
+     * @return always `0` (the number of registrable callback functions isn't limited)
      *
      * @pre The callback function pointer @p func **must not** be the `nullptr`.
-     * @pre The total number of added callback functions **must not** be greater or equal than *MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS*.
      *
-     * @assert_precondition{ If @p func is the `nullptr`. \n
-     *                       If adding @p func would exceed the size limit. }
+     * @assert_precondition{ If @p func is the `nullptr`. }
      *
      * @calls{
-     * int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state);    // exactly once
-     * int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);    // exactly once
+     * int MPI_Comm_create_keyval(MPI_Comm_copy_attr_function *comm_copy_attr_fn, MPI_Comm_delete_attr_function *comm_delete_attr_fn, int *comm_keyval, void *extra_state);    // at most once
+     * int MPI_Comm_set_attr(MPI_Comm comm, int comm_keyval, void *attribute_val);    // at most once
+     * + the MPI functions called by mpicxx::ensure_initialized()
      * }
      */
-    inline int atfinalize(detail::atfinalize_callback_t func) {
+    inline int atfinalize(const detail::atfinalize_callback_t func, const detail::atfinalize_registry::priority_type priority = 0) {
         MPICXX_ASSERT_PRECONDITION(func != nullptr, "The callback function cannot be nullptr!");
-        MPICXX_ASSERT_PRECONDITION(detail::atfinalize_idx < MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS,
-                "Maximum number of callback functions ({}) already registered!", MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS);
-
-        int comm_keyval;
-
-        // return if the number of registered callbacks exceeds the limit
-        if (detail::atfinalize_idx >= MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS) return 1;
-
-        // register function
-        detail::atfinalize_lookup_callbacks[detail::atfinalize_idx] = func;
-        MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &detail::atfinalize_delete_fn, &comm_keyval, nullptr);
-        MPI_Comm_set_attr(MPI_COMM_SELF, comm_keyval, nullptr);
-        ++detail::atfinalize_idx;
 
+        detail::atfinalize_callbacks.add(func, priority);
+        detail::atfinalize_register_keyval();
         return 0;
     }
     ///@}
@@ -0,0 +1,224 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements the stitching of the intercommunicators created by a hierarchical spawn (see
+ *        @ref mpicxx::multiple_spawner::spawn_hierarchical(const int)) and its counterpart on the spawned processes.
+ */
+
+#ifndef MPICXX_HIERARCHICAL_SPAWN_HPP
+#define MPICXX_HIERARCHICAL_SPAWN_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <mpi.h>
+
+#include <limits>
+#include <utility>
+
+namespace mpicxx {
+
+    /**
+     * @brief The communicators of a process spawned by @ref mpicxx::multiple_spawner::spawn_hierarchical(const int).
+     */
+    struct hierarchical_spawn_context {
+        /// The intercommunicator to **all** spawning processes (remote group) containing **all** spawned processes (local group).
+        MPI_Comm parent = MPI_COMM_NULL;
+        /// The intracommunicator containing **all** processes spawned by the same hierarchical spawn (replaces *MPI_COMM_WORLD*).
+        MPI_Comm world = MPI_COMM_NULL;
+    };
+
+    namespace detail {
+
+        /// Message tag used to create the intercommunicators while stitching a hierarchical spawn.
+        inline constexpr int hierarchical_spawn_tag = 32766;
+
+        /**
+         * @brief The actions the leader of a group broadcasts to all group members while stitching a hierarchical spawn.
+         */
+        enum class hierarchical_spawn_action : int {
+            /** the stitching is complete */
+            done,
+            /** merge with another group, this group is ordered first */
+            merge_low,
+            /** merge with another group, this group is ordered last */
+            merge_high
+        };
+
+        /**
+         * @brief Broadcasts @p action from the leader (rank `0`) of @p group to all processes in @p group.
+         * @param[in] group the current group
+         * @param[in] action the action (only significant at the leader)
+         * @return the broadcast action
+         *
+         * @calls{ int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);    // exactly once }
+         */
+        inline hierarchical_spawn_action hierarchical_spawn_broadcast(const MPI_Comm group, const hierarchical_spawn_action action) {
+            int value = static_cast<int>(action);
+            MPI_Bcast(&value, 1, MPI_INT, 0, group);
+            return static_cast<hierarchical_spawn_action>(value);
+        }
+
+        /**
+         * @brief Merges @p group with the group whose leader is @p remote_leader in @p peer and replaces @p group by the merged
+         *        intracommunicator.
+         * @param[inout] group the current group (freed and replaced)
+         * @param[in] action either @ref hierarchical_spawn_action::merge_low or @ref hierarchical_spawn_action::merge_high
+         * @param[in] peer the peer communicator containing both leaders (only significant at the leader)
+         * @param[in] remote_leader the rank of the remote leader in @p peer (only significant at the leader)
+         *
+         * @calls{
+         * int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm);    // exactly once
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);                                                            // exactly once
+         * int MPI_Comm_free(MPI_Comm *comm);                                                                                                        // exactly twice
+         * }
+         */
+        inline void hierarchical_spawn_merge(MPI_Comm& group, const hierarchical_spawn_action action, const MPI_Comm peer,
+                                             const int remote_leader)
+        {
+            MPI_Comm intercomm;
+            MPI_Intercomm_create(group, 0, peer, remote_leader, hierarchical_spawn_tag, &intercomm);
+            MPI_Comm merged;
+            MPI_Intercomm_merge(intercomm, static_cast<int>(action == hierarchical_spawn_action::merge_high), &merged);
+            MPI_Comm_free(&intercomm);
+            MPI_Comm_free(&group);
+            group = merged;
+        }
+
+        /**
+         * @brief Follows the actions broadcast by the leader of @p group until the stitching is complete.
+         * @param[inout] group the current group (replaced by the group containing **all** processes afterwards)
+         *
+         * @calls{
+         * int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);                                                   // at most 'log2(number of spawning processes) + 1' times
+         * int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm);    // at most 'log2(number of spawning processes)' times
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);                                                            // at most 'log2(number of spawning processes)' times
+         * }
+         */
+        inline void hierarchical_spawn_follow(MPI_Comm& group) {
+            for (;;) {
+                const hierarchical_spawn_action action = hierarchical_spawn_broadcast(group, hierarchical_spawn_action::done);
+                if (action == hierarchical_spawn_action::done) {
+                    return;
+                }
+                // the peer communicator and the remote leader are only significant at the leader
+                hierarchical_spawn_merge(group, action, MPI_COMM_NULL, 0);
+            }
+        }
+
+        /**
+         * @brief Leads the group @p group (i.e. the spawning process @p rank with its spawned processes) through the stitching.
+         * @details In round `s = 1, 2, 4, ...` the group led by @p rank merges with the group led by `rank + s` if `rank % 2s == 0`,
+         *          otherwise it gets absorbed by the group led by `rank - s`. Therefore, only `log2(size)` rounds are needed.
+         * @param[inout] group the current group (replaced by the group containing **all** processes afterwards)
+         * @param[in] rank the rank of the calling process in @p peer
+         * @param[in] size the size of @p peer
+         * @param[in] peer the communicator containing all spawning processes
+         *
+         * @calls{
+         * int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm);                                                   // at most 'log2(size) + 1' times
+         * int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm);    // at most 'log2(size)' times
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);                                                            // at most 'log2(size)' times
+         * }
+         */
+        inline void hierarchical_spawn_lead(MPI_Comm& group, const int rank, const int size, const MPI_Comm peer) {
+            for (int s = 1; s < size; s *= 2) {
+                if (rank % (2 * s) == 0) {
+                    if (rank + s < size) {
+                        hierarchical_spawn_broadcast(group, hierarchical_spawn_action::merge_low);
+                        hierarchical_spawn_merge(group, hierarchical_spawn_action::merge_low, peer, rank + s);
+                    }
+                } else {
+                    // this group gets absorbed -> the leader of the merged group takes over
+                    hierarchical_spawn_broadcast(group, hierarchical_spawn_action::merge_high);
+                    hierarchical_spawn_merge(group, hierarchical_spawn_action::merge_high, peer, rank - s);
+                    hierarchical_spawn_follow(group);
+                    return;
+                }
+            }
+            hierarchical_spawn_broadcast(group, hierarchical_spawn_action::done);
+        }
+
+        /**
+         * @brief Splits the group @p all containing **all** spawning and spawned processes into one intercommunicator between the
+         *        spawning and the spawned processes.
+         * @details Both, the spawning and the spawned processes, keep their relative order in @p all. @p all is freed afterwards.
+         * @param[inout] all the group containing all processes (the spawning process with rank `0` in @p peer must have rank `0`)
+         * @param[in] is_child `true` if the calling process is a spawned process, `false` otherwise
+         * @return the intercommunicator and the intracommunicator containing the local group
+         *
+         * @calls{
+         * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                                                                              // exactly once
+         * int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm);                                                                  // exactly once
+         * int MPI_Allreduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm);                        // exactly once
+         * int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm);    // exactly once
+         * int MPI_Comm_free(MPI_Comm *comm);                                                                                                        // exactly once
+         * }
+         */
+        inline std::pair<MPI_Comm, MPI_Comm> hierarchical_spawn_split(MPI_Comm& all, const bool is_child) {
+            int rank;
+            MPI_Comm_rank(all, &rank);
+            MPI_Comm local;
+            MPI_Comm_split(all, static_cast<int>(is_child), rank, &local);
+
+            // the leader of the spawning processes has rank 0, the leader of the spawned processes is the spawned process with the lowest rank
+            const int candidate = is_child ? rank : std::numeric_limits<int>::max();
+            int child_leader;
+            MPI_Allreduce(&candidate, &child_leader, 1, MPI_INT, MPI_MIN, all);
+
+            MPI_Comm intercomm;
+            MPI_Intercomm_create(local, 0, all, is_child ? 0 : child_leader, hierarchical_spawn_tag, &intercomm);
+            MPI_Comm_free(&all);
+            return std::make_pair(intercomm, local);
+        }
+
+    }
+
+    /**
+     * @brief Joins the hierarchical spawn (see @ref mpicxx::multiple_spawner::spawn_hierarchical(const int)) which spawned the
+     *        current process.
+     * @details Must be called by **all** spawned processes (after receiving their payload via @ref mpicxx::receive_payload() if any
+     *          has been set). Each spawned process has been spawned by **one** of the spawning processes. The intercommunicators of
+     *          all spawning processes get stitched together, such that afterwards one intercommunicator to **all** spawning processes
+     *          and one intracommunicator containing **all** spawned processes exist. \n
+     *          The returned @ref mpicxx::hierarchical_spawn_context::parent **must** be disconnected via
+     *          [*MPI_Comm_disconnect*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node247.htm) before finalizing the MPI
+     *          environment.
+     * @return the stitched communicators
+     * @nodiscard
+     *
+     * @pre The current process **must** have been spawned by @ref mpicxx::multiple_spawner::spawn_hierarchical(const int).
+     *
+     * @assert_precondition{ If the current process hasn't been spawned. }
+     *
+     * @calls{
+     * int MPI_Comm_get_parent(MPI_Comm *parent);                                                                                                // exactly once
+     * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);                                                            // at most 'log2(number of spawning processes) + 1' times
+     * int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm);    // at most 'log2(number of spawning processes) + 1' times
+     * int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm);                                                                  // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
+     */
+    [[nodiscard]]
+    inline hierarchical_spawn_context join_hierarchical_spawn() {
+        mpicxx::ensure_initialized();
+
+        MPI_Comm parent;
+        MPI_Comm_get_parent(&parent);
+        MPICXX_ASSERT_PRECONDITION(parent != MPI_COMM_NULL, "Attempt to join a hierarchical spawn without a parent process!");
+
+        // the spawning process is ordered before its spawned processes
+        MPI_Comm group;
+        MPI_Intercomm_merge(parent, 1, &group);
+        detail::hierarchical_spawn_follow(group);
+
+        const auto [intercomm, world] = detail::hierarchical_spawn_split(group, true);
+        return hierarchical_spawn_context{ intercomm, world };
+    }
+
+}
+
+#endif // MPICXX_HIERARCHICAL_SPAWN_HPP
@@ -12,12 +12,50 @@
 
 #include <mpicxx/detail/assert.hpp>
 #include <mpicxx/exception/thread_support_exception.hpp>
+#include <mpicxx/info/runtime_info.hpp>
 #include <mpicxx/startup/thread_support.hpp>
 
 #include <mpi.h>
 
+#include <atomic>
+#include <mutex>
+#include <optional>
+
 namespace mpicxx {
 
+    namespace detail {
+
+        /**
+         * @brief Invoked by the @ref mpicxx::init(const thread_support) and @ref mpicxx::init(int&, char**, const thread_support)
+         *        functions with the provided level of thread support after the MPI environment has been successfully initialized
+         *        (e.g. used to start the global @ref mpicxx::progress_engine).
+         */
+        inline void (*post_init_hook)(thread_support) = nullptr;
+
+        /**
+         * @brief The parameters of a deferred initialization (see @ref mpicxx::defer_init()).
+         */
+        struct deferred_init_parameters {
+            /// The number of command line arguments (`nullptr` if no command line arguments have been provided).
+            int* argc = nullptr;
+            /// The command line arguments.
+            char** argv = nullptr;
+            /// The required level of thread support (if not set, the MPI environment gets initialized via @ref mpicxx::init()).
+            std::optional<thread_support> required;
+        };
+
+        /// The parameters of the deferred initialization (only set if @ref mpicxx::defer_init() has been called).
+        inline std::optional<deferred_init_parameters> deferred_init;
+        /// Guarantees that the deferred initialization is performed at most once.
+        inline std::once_flag deferred_init_flag;
+        /// `true` if the deferred initialization has been performed (the fast path of @ref mpicxx::ensure_initialized()).
+        inline std::atomic<bool> deferred_init_done = false;
+        /// `true` while the current thread performs the deferred initialization (allows reentrant calls of
+        /// @ref mpicxx::ensure_initialized(), e.g. by @ref mpicxx::runtime_info()).
+        inline thread_local bool deferred_init_running = false;
+
+    }
+
     /// @name initialization of the MPI environment
     ///@{
     /**
@@ -69,12 +107,17 @@ namespace mpicxx {
      *
      * @assert_precondition{ If the MPI environment has already been initialized. }
      *
-     * @calls{ int MPI_Init(int *argc, char ***argv);    // exactly once  }
+     * @calls{
+     * int MPI_Init(int *argc, char ***argv);    // exactly once
+     * + the MPI functions called by mpicxx::runtime_info() to fill the runtime info cache
+     * }
      */
     inline void init() {
         MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
 
         MPI_Init(nullptr, nullptr);
+        // fill the process-wide runtime info cache
+        static_cast<void>(mpicxx::runtime_info());
     }
     /**
      * @brief Initialize the MPI environment.
@@ -88,12 +131,17 @@ namespace mpicxx {
      *
      * @assert_precondition{ If the MPI environment has already been initialized. }
      *
-     * @calls{ int MPI_Init(int *argc, char ***argv);    // exactly once }
+     * @calls{
+     * int MPI_Init(int *argc, char ***argv);    // exactly once
+     * + the MPI functions called by mpicxx::runtime_info() to fill the runtime info cache
+     * }
      */
     inline void init(int& argc, char** argv) {
         MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
 
         MPI_Init(&argc, &argv);
+        // fill the process-wide runtime info cache
+        static_cast<void>(mpicxx::runtime_info());
     }
 
     /**
@@ -116,19 +164,28 @@ namespace mpicxx {
      *
      * @throws mpicxx::thread_support_not_satisfied if the requested level of thread support cannot be satisfied
      *
-     * @calls{ int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);    // exactly once }
+     * @calls{
+     * int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);    // exactly once
+     * + the MPI functions called by mpicxx::runtime_info() to fill the runtime info cache
+     * + the MPI functions called by the global mpicxx::progress_engine (if started on initialization)
+     * }
      */
     inline thread_support init(const thread_support required) {
         MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
 
         int provided_in;
         MPI_Init_thread(nullptr, nullptr, static_cast<int>(required), &provided_in);
+        // fill the process-wide runtime info cache
+        static_cast<void>(mpicxx::runtime_info());
 
         // throw an exception if the required level of thread support can't be satisfied
         thread_support provided = static_cast<thread_support>(provided_in);
         if (required > provided) {
             MPICXX_THROW_EXCEPTION(thread_support_not_satisfied, required, provided);
         }
+        if (detail::post_init_hook != nullptr) {
+            detail::post_init_hook(provided);
+        }
         return provided;
     }
     /**
@@ -152,22 +209,166 @@ namespace mpicxx {
      *
      * @throws mpicxx::thread_support_not_satisfied if the requested level of thread support cannot be satisfied
      *
-     * @calls{ int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);    // exactly once }
+     * @calls{
+     * int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);    // exactly once
+     * + the MPI functions called by mpicxx::runtime_info() to fill the runtime info cache
+     * + the MPI functions called by the global mpicxx::progress_engine (if started on initialization)
+     * }
      */
     inline thread_support init(int& argc, char** argv, const thread_support required) {
         MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
 
         int provided_in;
         MPI_Init_thread(&argc, &argv, static_cast<int>(required), &provided_in);
+        // fill the process-wide runtime info cache
+        static_cast<void>(mpicxx::runtime_info());
 
         // throw an exception if the required level of thread support can't be satisfied
         thread_support provided = static_cast<thread_support>(provided_in);
         if (required > provided) {
             MPICXX_THROW_EXCEPTION(thread_support_not_satisfied, required, provided);
         }
+        if (detail::post_init_hook != nullptr) {
+            detail::post_init_hook(provided);
+        }
         return provided;
     }
 
+    /**
+     * @brief Performs the deferred initialization of the MPI environment (if requested via @ref mpicxx::defer_init() and not yet
+     *        performed).
+     * @details Called by the mpicxx functions which need an initialized MPI environment (e.g. @ref mpicxx::runtime_info(),
+     *          @ref mpicxx::provided_thread_support() or the spawn functions). Does nothing if no initialization has been deferred. \n
+     *          After the MPI environment has been initialized, only **one** atomic load is performed. Before that, a
+     *          [`std::once_flag`](https://en.cppreference.com/w/cpp/thread/once_flag) guarantees that the initialization is performed at
+     *          most once: all other threads calling this function wait until it has been completed. Reentrant calls by the thread
+     *          performing the initialization return immediately.
+     *
+     *    This function is thread safe. The thread performing the deferred initialization becomes the main thread (see
+     *    @ref mpicxx::is_main_thread()).
+     *
+     * @throws mpicxx::thread_support_not_satisfied if the required level of thread support of the deferred initialization cannot be
+     *         satisfied (only thrown by the call performing the initialization)
+     *
+     * @calls{
+     * int MPI_Initialized(int *flag);    // at most once
+     * + the MPI functions called by the deferred mpicxx::init() function (at most once)
+     * }
+     */
+    inline void ensure_initialized() {
+        // fast path: the deferred initialization has already been performed (or no initialization has been deferred at all)
+        if (detail::deferred_init_done.load(std::memory_order_acquire) || !detail::deferred_init.has_value()) {
+            return;
+        }
+
+        // reentrant call during the initialization performed by the current thread
+        if (detail::deferred_init_running) {
+            return;
+        }
+
+        // all other threads wait until the initialization has been performed
+        std::call_once(detail::deferred_init_flag, []() {
+            detail::deferred_init_running = true;
+            struct reset_running {
+                ~reset_running() { detail::deferred_init_running = false; }
+            } reset;
+
+            // the MPI environment may already be initialized if a previous initialization attempt threw
+            if (!initialized()) {
+                const detail::deferred_init_parameters& params = detail::deferred_init.value();
+                if (params.argc != nullptr && params.required.has_value()) {
+                    init(*params.argc, params.argv, params.required.value());
+                } else if (params.argc != nullptr) {
+                    init(*params.argc, params.argv);
+                } else if (params.required.has_value()) {
+                    init(params.required.value());
+                } else {
+                    init();
+                }
+            }
+            detail::deferred_init_done.store(true, std::memory_order_release);
+        });
+    }
+
+    /**
+     * @brief Defers the initialization of the MPI environment until the first mpicxx call which actually needs it (see
+     *        @ref mpicxx::ensure_initialized()).
+     * @details Tools which often exit without any communication (e.g. after printing a help text or during a dry-run) don't pay for
+     *          [*MPI_Init*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) this way. \n
+     *          The deferred initialization calls @ref mpicxx::init(). Use @ref mpicxx::initialized() to check whether it has been
+     *          performed, e.g. to decide whether @ref mpicxx::finalize() has to be called.
+     *
+     * @pre The MPI environment **must not** be initialized.
+     *
+     * @assert_precondition{ If the MPI environment has already been initialized. }
+     *
+     * @calls{ int MPI_Initialized(int *flag);    // exactly once }
+     */
+    inline void defer_init() {
+        MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
+
+        detail::deferred_init = detail::deferred_init_parameters{};
+        detail::runtime_info_pre_fill_hook = &mpicxx::ensure_initialized;
+    }
+    /**
+     * @brief Defers the initialization of the MPI environment until the first mpicxx call which actually needs it (see
+     *        @ref mpicxx::ensure_initialized()).
+     * @details The deferred initialization calls @ref mpicxx::init(int& argc, char** argv). See @ref mpicxx::defer_init().
+     * @param[inout] argc number of command line arguments (**must** outlive the deferred initialization)
+     * @param[inout] argv command line arguments (**must** outlive the deferred initialization)
+     *
+     * @pre The MPI environment **must not** be initialized.
+     *
+     * @assert_precondition{ If the MPI environment has already been initialized. }
+     *
+     * @calls{ int MPI_Initialized(int *flag);    // exactly once }
+     */
+    inline void defer_init(int& argc, char** argv) {
+        MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
+
+        detail::deferred_init = detail::deferred_init_parameters{ &argc, argv, std::nullopt };
+        detail::runtime_info_pre_fill_hook = &mpicxx::ensure_initialized;
+    }
+    /**
+     * @brief Defers the initialization of the MPI environment with the required level of thread support until the first mpicxx call which
+     *        actually needs it (see @ref mpicxx::ensure_initialized()).
+     * @details The deferred initialization calls @ref mpicxx::init(const thread_support). See @ref mpicxx::defer_init().
+     * @param[in] required the required level of thread support
+     *
+     * @pre The MPI environment **must not** be initialized.
+     *
+     * @assert_precondition{ If the MPI environment has already been initialized. }
+     *
+     * @calls{ int MPI_Initialized(int *flag);    // exactly once }
+     */
+    inline void defer_init(const thread_support required) {
+        MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
+
+        detail::deferred_init = detail::deferred_init_parameters{ nullptr, nullptr, required };
+        detail::runtime_info_pre_fill_hook = &mpicxx::ensure_initialized;
+    }
+    /**
+     * @brief Defers the initialization of the MPI environment with the required level of thread support until the first mpicxx call which
+     *        actually needs it (see @ref mpicxx::ensure_initialized()).
+     * @details The deferred initialization calls @ref mpicxx::init(int& argc, char** argv, const thread_support). See
+     *          @ref mpicxx::defer_init().
+     * @param[inout] argc number of command line arguments (**must** outlive the deferred initialization)
+     * @param[inout] argv command line arguments (**must** outlive the deferred initialization)
+     * @param[in] required the required level of thread support
+     *
+     * @pre The MPI environment **must not** be initialized.
+     *
+     * @assert_precondition{ If the MPI environment has already been initialized. }
+     *
+     * @calls{ int MPI_Initialized(int *flag);    // exactly once }
+     */
+    inline void defer_init(int& argc, char** argv, const thread_support required) {
+        MPICXX_ASSERT_PRECONDITION(!initialized(), "MPI environment already initialized!");
+
+        detail::deferred_init = detail::deferred_init_parameters{ &argc, argv, required };
+        detail::runtime_info_pre_fill_hook = &mpicxx::ensure_initialized;
+    }
+
     /**
      * @brief Query the provided level of thread support.
      * @details Note that the provided level of thread support must **not** be equal to the requested level of thread support but could be
@@ -180,10 +381,15 @@ namespace mpicxx {
      * @return the provided level of thread support
      * @nodiscard
      *
-     * @calls{ int MPI_Query_thread(int *provided);    // exactly once }
+     * @calls{
+     * int MPI_Query_thread(int *provided);    // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
      */
     [[nodiscard]]
     inline thread_support provided_thread_support() {
+        mpicxx::ensure_initialized();
+
         int provided;
         MPI_Query_thread(&provided);
         return static_cast<thread_support>(provided);
@@ -195,14 +401,38 @@ namespace mpicxx {
      * @return `true` if this is the main thread, otherwise `false`
      * @nodiscard
      *
-     * @calls{ int MPI_Is_thread_main(int *flag);    // exactly once }
+     * @calls{
+     * int MPI_Is_thread_main(int *flag);    // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
      */
     [[nodiscard]]
     inline bool is_main_thread() {
+        mpicxx::ensure_initialized();
+
         int flag;
         MPI_Is_thread_main(&flag);
         return static_cast<bool>(flag);
     }
+
+    /**
+     * @brief Checks whether the provided level of thread support is at least @p required.
+     * @details Used by functions which internally call MPI functions from a helper thread (e.g.
+     *          @ref mpicxx::multiple_spawner::spawn_async()).
+     *
+     *    This function is thread safe as required by the [MPI standard 3.1](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report.pdf).
+     * @param[in] required the required level of thread support
+     *
+     * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support is less than @p required
+     *
+     * @calls{ int MPI_Query_thread(int *provided);    // exactly once }
+     */
+    inline void require_thread_support(const thread_support required) {
+        const thread_support provided = mpicxx::provided_thread_support();
+        if (required > provided) {
+            MPICXX_THROW_EXCEPTION(thread_support_not_satisfied, required, provided);
+        }
+    }
     ///@}
 
 }
@@ -0,0 +1,158 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements an owning intracommunicator created by merging the intercommunicator between spawning and spawned processes.
+ */
+
+#ifndef MPICXX_MERGED_COMMUNICATOR_HPP
+#define MPICXX_MERGED_COMMUNICATOR_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <mpi.h>
+
+#include <memory>
+#include <utility>
+
+namespace mpicxx {
+
+    /**
+     * @brief An owning intracommunicator created via
+     *        [*MPI_Intercomm_merge*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node170.htm).
+     * @details Created by @ref mpicxx::spawn_result::merge(), @ref mpicxx::spawn_result_with_errcodes::merge() and (on the spawned
+     *          processes) @ref mpicxx::merge_with_parent(). The group whose processes passed `high = false` is ordered before the group
+     *          whose processes passed `high = true`. \n
+     *          The communicator is freed on destruction (if the MPI environment hasn't been finalized yet).
+     */
+    class merged_communicator {
+    public:
+        /**
+         * @brief Merges the two groups of the intercommunicator @p intercomm into a new intracommunicator.
+         * @details Collective over **all** processes of both groups of @p intercomm.
+         * @param[in] intercomm the intercommunicator
+         * @param[in] high `false` if this group should be ordered first, `true` if it should be ordered last
+         *
+         * @pre @p intercomm **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If @p intercomm is [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @calls{
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);    // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        merged_communicator(const MPI_Comm intercomm, const bool high) {
+            mpicxx::ensure_initialized();
+            MPICXX_ASSERT_PRECONDITION(intercomm != MPI_COMM_NULL, "Attempt to merge the null communicator!");
+
+            MPI_Intercomm_merge(intercomm, static_cast<int>(high), &comm_);
+        }
+        /**
+         * @brief Move constructor. Transfers the ownership of the communicator.
+         * @param[inout] other the moved-from object (refers to [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)
+         *                     afterwards)
+         */
+        merged_communicator(merged_communicator&& other) noexcept : comm_(std::exchange(other.comm_, MPI_COMM_NULL)) { }
+        /**
+         * @brief Move assignment operator. Frees the currently owned communicator and transfers the ownership of @p rhs's communicator.
+         * @param[inout] rhs the moved-from object (refers to [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)
+         *                   afterwards)
+         * @return `*this`
+         *
+         * @calls{ int MPI_Comm_free(MPI_Comm *comm);    // at most once }
+         */
+        merged_communicator& operator=(merged_communicator&& rhs) noexcept {
+            if (this != std::addressof(rhs)) {
+                this->free_communicator();
+                comm_ = std::exchange(rhs.comm_, MPI_COMM_NULL);
+            }
+            return *this;
+        }
+        /**
+         * @brief Deleted copy constructor.
+         */
+        merged_communicator(const merged_communicator&) = delete;
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        merged_communicator& operator=(const merged_communicator&) = delete;
+        /**
+         * @brief Destructs the @ref mpicxx::merged_communicator object, i.e. frees the owned communicator.
+         *
+         * @calls{
+         * int MPI_Finalized(int *flag);         // at most once
+         * int MPI_Comm_free(MPI_Comm *comm);    // at most once
+         * }
+         */
+        ~merged_communicator() {
+            this->free_communicator();
+        }
+
+        /**
+         * @brief Returns the rank of the calling process in the merged communicator.
+         * @return the rank
+         * @nodiscard
+         *
+         * @calls{ int MPI_Comm_rank(MPI_Comm comm, int *rank);    // exactly once }
+         */
+        [[nodiscard]]
+        int rank() const {
+            int rank;
+            MPI_Comm_rank(comm_, &rank);
+            return rank;
+        }
+        /**
+         * @brief Returns the number of processes (of both groups) in the merged communicator.
+         * @return the size
+         * @nodiscard
+         *
+         * @calls{ int MPI_Comm_size(MPI_Comm comm, int *size);    // exactly once }
+         */
+        [[nodiscard]]
+        int size() const {
+            int size;
+            MPI_Comm_size(comm_, &size);
+            return size;
+        }
+        /**
+         * @brief Get the underlying [*MPI_Comm*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm) (without transferring
+         *        the ownership).
+         * @return the underlying [*MPI_Comm*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        MPI_Comm get() const noexcept { return comm_; }
+        /**
+         * @brief Releases the ownership of the underlying [*MPI_Comm*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm),
+         *        i.e. the caller is responsible for freeing it.
+         * @return the underlying [*MPI_Comm*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        MPI_Comm release() noexcept { return std::exchange(comm_, MPI_COMM_NULL); }
+
+    private:
+        /*
+         * @brief Frees the owned communicator (if any and if the MPI environment hasn't been finalized yet).
+         */
+        void free_communicator() noexcept {
+            if (comm_ != MPI_COMM_NULL) {
+                int flag;
+                MPI_Finalized(&flag);
+                if (!static_cast<bool>(flag)) {
+                    MPI_Comm_free(&comm_);
+                }
+                comm_ = MPI_COMM_NULL;
+            }
+        }
+
+        MPI_Comm comm_ = MPI_COMM_NULL;
+    };
+
+}
+
+#endif // MPICXX_MERGED_COMMUNICATOR_HPP
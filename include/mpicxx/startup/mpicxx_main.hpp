@@ -15,6 +15,7 @@
 #include <mpicxx/detail/concepts.hpp>
 #include <mpicxx/startup/finalize.hpp>
 #include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/startup_report.hpp>
 
 #include <cstdlib>
 #include <functional>
@@ -22,8 +23,29 @@
 
 namespace mpicxx {
 
+    namespace detail {
+
+        /// `true` if @ref mpicxx::main() should defer the initialization of the MPI environment.
+        inline bool lazy_init_enabled = false;
+
+    }
+
     /// @name automatic initialization and finalization of the MPI environment
     ///@{
+    /**
+     * @brief Enables (or disables) the lazy initialization mode of @ref mpicxx::main().
+     * @details If enabled, @ref mpicxx::main() doesn't initialize the MPI environment before invoking the user defined main function but
+     *          defers the initialization via @ref mpicxx::defer_init() until the first mpicxx call which actually needs it (see
+     *          @ref mpicxx::ensure_initialized()). Afterwards, the MPI environment is only finalized if it has been initialized. \n
+     *          Useful for tools which often exit without any communication, e.g. after printing a help text. \n
+     *          The lazy initialization mode is disabled by default and **must** be configured before calling @ref mpicxx::main().
+     * @param[in] enable `true` to enable the lazy initialization mode, `false` to disable it
+     *
+     *    Example: @snippet examples/startup/mpicxx_main.cpp mpicxx_main version with lazy initialization
+     */
+    inline void enable_lazy_init(const bool enable = true) noexcept {
+        detail::lazy_init_enabled = enable;
+    }
     /**
      * @brief Correctly setup and teardown the MPI environment while executing the code given by @p func.
      * @details This function performs the following tasks in the given order:
@@ -31,6 +53,11 @@ namespace mpicxx {
      *          2. invoke the function represented by @p func (forwarding all additional parameters)
      *          3. call @ref mpicxx::finalize()
      *
+     *          If enabled via @ref mpicxx::enable_lazy_init(), step 1 is deferred until the first mpicxx call which actually needs the
+     *          MPI environment and step 3 is only performed if the MPI environment has been initialized. \n
+     *          If enabled via @ref mpicxx::startup_profiling, the duration of each step is measured and a @ref mpicxx::startup_report
+     *          is written on rank `0`.
+     *
      *          Example:
      *          @snippet examples/startup/init_and_finalize.cpp normal version without args and thread support
      *          is the same as:
@@ -56,17 +83,25 @@ namespace mpicxx {
      *                       If the MPI environment has already been finalized. }
      *
      * @calls{
-     * int MPI_Init(int *argc, char ***argv);    // exactly once
-     * int MPI_Finalize();                       // exactly once
+     * int MPI_Init(int *argc, char ***argv);                                                                                       // exactly once (at most once if the lazy initialization is enabled)
+     * int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);    // exactly three times (only if the profiling is enabled)
+     * int MPI_Finalize();                                                                                                          // exactly once (at most once if the lazy initialization is enabled)
      * }
      */
     template <typename FuncPtr, typename... Args>
     inline int main(FuncPtr func, Args&&... args) requires detail::is_main_pointer<FuncPtr, Args...> {
-        init();
+        detail::startup_profiler profiler;
+        profiler.start(startup_phase::init);
+        if (detail::lazy_init_enabled) {
+            defer_init();
+        } else {
+            init();
+        }
 
+        profiler.start(startup_phase::main);
         int ret = std::invoke(func, std::forward<Args>(args)...);
 
-        finalize();
+        profiler.finalize();
         return ret;
     }
     /**
@@ -76,6 +111,11 @@ namespace mpicxx {
      *          2. invoke the function represented by @p func (forwarding all additional parameters)
      *          3. call @ref mpicxx::finalize()
      *
+     *          If enabled via @ref mpicxx::enable_lazy_init(), step 1 is deferred until the first mpicxx call which actually needs the
+     *          MPI environment and step 3 is only performed if the MPI environment has been initialized. \n
+     *          If enabled via @ref mpicxx::startup_profiling, the duration of each step is measured and a @ref mpicxx::startup_report
+     *          is written on rank `0`.
+     *
      *          Example:
      *          @snippet examples/startup/init_and_finalize.cpp normal version with args and without thread support
      *          is the same as:
@@ -103,17 +143,25 @@ namespace mpicxx {
      *                       If the MPI environment has already been finalized. }
      *
      * @calls{
-     * int MPI_Init(int *argc, char ***argv);    // exactly once
-     * int MPI_Finalize();                       // exactly once
+     * int MPI_Init(int *argc, char ***argv);                                                                                       // exactly once (at most once if the lazy initialization is enabled)
+     * int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);    // exactly three times (only if the profiling is enabled)
+     * int MPI_Finalize();                                                                                                          // exactly once (at most once if the lazy initialization is enabled)
      * }
      */
     template <typename FuncPtr, typename... Args>
     inline int main(FuncPtr func, int& argc, char** argv, Args&&... args) requires detail::is_main_args_pointer<FuncPtr, Args...> {
-        init(argc, argv);
+        detail::startup_profiler profiler;
+        profiler.start(startup_phase::init);
+        if (detail::lazy_init_enabled) {
+            defer_init(argc, argv);
+        } else {
+            init(argc, argv);
+        }
 
+        profiler.start(startup_phase::main);
         int ret = std::invoke(func, argc, argv, std::forward<Args>(args)...);
 
-        finalize();
+        profiler.finalize();
         return ret;
     }
 
@@ -127,6 +175,11 @@ namespace mpicxx {
      *          2. invoke the function represented by @p func (forwarding all additional parameters)
      *          3. call @ref mpicxx::finalize()
      *
+     *          If enabled via @ref mpicxx::enable_lazy_init(), step 1 is deferred until the first mpicxx call which actually needs the
+     *          MPI environment and step 3 is only performed if the MPI environment has been initialized. \n
+     *          If enabled via @ref mpicxx::startup_profiling, the duration of each step is measured and a @ref mpicxx::startup_report
+     *          is written on rank `0`.
+     *
      *          Example:
      *          @snippet examples/startup/init_and_finalize.cpp normal version without args and with thread support
      *          is nearly the same as (except for the return value):
@@ -154,21 +207,29 @@ namespace mpicxx {
      *                       If the MPI environment has already been finalized. }
      *
      * @calls{
-     * int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);    // exactly once
-     * int MPI_Finalize();                                                           // exactly once
+     * int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);                                                   // exactly once (at most once if the lazy initialization is enabled)
+     * int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);    // exactly three times (only if the profiling is enabled)
+     * int MPI_Finalize();                                                                                                          // exactly once (at most once if the lazy initialization is enabled)
      * }
      */
     template <typename FuncPtr, typename... Args>
     inline int main(FuncPtr func, const thread_support required, Args&&... args) requires detail::is_main_pointer<FuncPtr, Args...> {
+        detail::startup_profiler profiler;
         int ret = EXIT_FAILURE;
         try {
-            init(required);
+            profiler.start(startup_phase::init);
+            if (detail::lazy_init_enabled) {
+                defer_init(required);
+            } else {
+                init(required);
+            }
+            profiler.start(startup_phase::main);
             ret = std::invoke(func, std::forward<Args>(args)...);
         } catch (const mpicxx::thread_support_not_satisfied& e) {
             std::cerr << e.what() << std::endl;
         }
 
-        finalize();
+        profiler.finalize();
         return ret;
     }
     /**
@@ -181,6 +242,11 @@ namespace mpicxx {
      *          2. invoke the function represented by @p func (forwarding all additional parameters)
      *          3. call @ref mpicxx::finalize()
      *
+     *          If enabled via @ref mpicxx::enable_lazy_init(), step 1 is deferred until the first mpicxx call which actually needs the
+     *          MPI environment and step 3 is only performed if the MPI environment has been initialized. \n
+     *          If enabled via @ref mpicxx::startup_profiling, the duration of each step is measured and a @ref mpicxx::startup_report
+     *          is written on rank `0`.
+     *
      *          Example:
      *          @snippet examples/startup/init_and_finalize.cpp normal version with args and thread support
      *          is nearly the same as (except for the return value):
@@ -210,21 +276,29 @@ namespace mpicxx {
      *                       If the MPI environment has already been finalized. }
      *
      * @calls{
-     * int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);    // exactly once
-     * int MPI_Finalize();                                                           // exactly once
+     * int MPI_Init_thread(int *argc, char ***argv, int required, int *provided);                                                   // exactly once (at most once if the lazy initialization is enabled)
+     * int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);    // exactly three times (only if the profiling is enabled)
+     * int MPI_Finalize();                                                                                                          // exactly once (at most once if the lazy initialization is enabled)
      * }
      */
     template <typename FuncPtr, typename... Args>
     inline int main(FuncPtr func, int& argc, char** argv, const thread_support required, Args&&... args) requires detail::is_main_args_pointer<FuncPtr, Args...> {
+        detail::startup_profiler profiler;
         int ret = EXIT_FAILURE;
         try {
-            init(argc, argv, required);
+            profiler.start(startup_phase::init);
+            if (detail::lazy_init_enabled) {
+                defer_init(argc, argv, required);
+            } else {
+                init(argc, argv, required);
+            }
+            profiler.start(startup_phase::main);
             ret = std::invoke(func, argc, argv, std::forward<Args>(args)...);
         } catch (const mpicxx::thread_support_not_satisfied& e) {
             std::cerr << e.what() << std::endl;
         }
 
-        finalize();
+        profiler.finalize();
         return ret;
     }
     ///@}
@@ -11,20 +11,31 @@
 #ifndef MPICXX_MULTIPLE_SPAWNER_HPP
 #define MPICXX_MULTIPLE_SPAWNER_HPP
 
+#include <mpicxx/chrono/clock.hpp>
 #include <mpicxx/detail/assert.hpp>
 #include <mpicxx/detail/concepts.hpp>
 #include <mpicxx/detail/conversion.hpp>
 #include <mpicxx/detail/utility.hpp>
 #include <mpicxx/info/info.hpp>
 #include <mpicxx/info/runtime_info.hpp>
+#include <mpicxx/startup/hierarchical_spawn.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/prepared_spawn.hpp>
 #include <mpicxx/startup/single_spawner.hpp>
+#include <mpicxx/startup/spawn_payload.hpp>
 #include <mpicxx/startup/spawn_result.hpp>
+#include <mpicxx/startup/thread_support.hpp>
 
 #include <fmt/format.h>
 #include <mpi.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <future>
+#include <limits>
 #include <numeric>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -127,6 +138,8 @@ namespace mpicxx {
             info_.assign(size_, mpicxx::info::null);
             // set command line arguments to default values
             argvs_.assign(size_, std::vector<std::string>());
+            // set payloads to default values
+            payloads_.assign(size_, std::nullopt);
         }
         /**
          * @brief Constructs the @ref mpicxx::multiple_spawner object with the contents of the two
@@ -203,6 +216,8 @@ namespace mpicxx {
             info_.assign(size_, mpicxx::info::null);
             // set command line arguments to default values
             argvs_.assign(size_, std::vector<std::string>());
+            // set payloads to default values
+            payloads_.assign(size_, std::nullopt);
         }
         /**
          * @brief Constructs the @ref mpicxx::multiple_spawner object with the contents of the
@@ -265,6 +280,8 @@ namespace mpicxx {
             info_.assign(size_, mpicxx::info::null);
             // set command line arguments to default values
             argvs_.assign(size_, std::vector<std::string>());
+            // set payloads to default values
+            payloads_.assign(size_, std::nullopt);
         }
         /**
          * @brief Constructs the @ref mpicxx::multiple_spawner object with the spawner object(s) of the parameter pack @p args.
@@ -295,6 +312,7 @@ namespace mpicxx {
                     argvs_.emplace_back(std::forward<spawner_t>(arg).argv());
                     maxprocs_.emplace_back(std::forward<spawner_t>(arg).maxprocs());
                     info_.emplace_back(std::forward<spawner_t>(arg).spawn_info());
+                    payloads_.emplace_back(std::forward<spawner_t>(arg).payload());
                 } else if constexpr (std::is_same_v<std::remove_cvref_t<spawner_t>, multiple_spawner>) {
                     size_ += arg.size();
                     for (multiple_spawner::size_type i = 0; i < arg.size(); ++i) {
@@ -302,6 +320,7 @@ namespace mpicxx {
                         argvs_.emplace_back(std::forward<spawner_t>(arg).argv_at(i));
                         maxprocs_.emplace_back(std::forward<spawner_t>(arg).maxprocs_at(i));
                         info_.emplace_back(std::forward<spawner_t>(arg).spawn_info_at(i));
+                        payloads_.emplace_back(std::forward<spawner_t>(arg).payload_at(i));
                     }
                 }
                 root_ = arg.root();
@@ -927,6 +946,56 @@ namespace mpicxx {
             return *this;
         }
 
+        /**
+         * @brief Set the payload handed off to **all** spawned processes of the @p i-th executable (which receive it via
+         *        @ref mpicxx::receive_payload()).
+         * @details Contrary to the command line arguments, the payload isn't converted to strings: it's sent as **one** message over the
+         *          intercommunicator created by the spawn. \n
+         *          The payload is only significant at the root process.
+         *
+         *    Example: @snippet examples/startup/multiple_spawner.cpp spawn with payload
+         * @param[in] i the index of the executable
+         * @param[in] payload the payload
+         * @return `*this`
+         *
+         * @pre @p i **must not** be greater than `this->size()`.
+         * @pre The size of @p payload **must not** be greater than the maximum value representable by an `int`.
+         *
+         * @throws std::out_of_range if the index @p i falls outside the valid range
+         * @throws std::length_error if @p payload is too large
+         */
+        multiple_spawner& set_payload_at(const std::size_t i, const std::span<const std::byte> payload) {
+            if (i >= this->size()) {
+                throw std::out_of_range(fmt::format(
+                        "multiple_spawner::set_payload_at(const std::size_t, std::span<const std::byte>) range check: i (which is {}) >= this->size() (which is {})",
+                        i, this->size()));
+            }
+
+            detail::check_spawn_payload_size(payload.size());
+
+            payloads_[i].emplace(payload.begin(), payload.end());
+            return *this;
+        }
+        /**
+         * @brief Removes the payload of the @p i-th executable, i.e. nothing gets handed off to its spawned processes.
+         * @param[in] i the index of the executable
+         * @return `*this`
+         *
+         * @pre @p i **must not** be greater than `this->size()`.
+         *
+         * @throws std::out_of_range if the index @p i falls outside the valid range
+         */
+        multiple_spawner& remove_payload_at(const std::size_t i) {
+            if (i >= this->size()) {
+                throw std::out_of_range(fmt::format(
+                        "multiple_spawner::remove_payload_at(const std::size_t) range check: i (which is {}) >= this->size() (which is {})",
+                        i, this->size()));
+            }
+
+            payloads_[i].reset();
+            return *this;
+        }
+
         /**
          * @brief Set the rank of the root process (from which the other processes are spawned).
          * @param[in] root the root process
@@ -1147,6 +1216,36 @@ namespace mpicxx {
             return info_[i];
         }
 
+        /**
+         * @brief Returns the payloads handed off to the spawned processes of the executables.
+         * @return the payloads (@ref mpicxx::spawn_payload_type or
+         *         [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if no payload has been set)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const std::vector<std::optional<spawn_payload_type>>& payload() const noexcept { return payloads_; }
+        /**
+         * @brief Returns the payload handed off to the spawned processes of the @p i-th executable.
+         * @param[in] i the index of the executable
+         * @return the @p i-th payload or [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if no payload has
+         *         been set
+         * @nodiscard
+         *
+         * @pre @p i **must not** be greater than `this->size()`.
+         *
+         * @throws std::out_of_range if the index @p i falls outside the valid range
+         */
+        [[nodiscard]]
+        const std::optional<spawn_payload_type>& payload_at(const std::size_t i) const {
+            if (i >= this->size()) {
+                throw std::out_of_range(fmt::format(
+                        "multiple_spawner::payload_at(const std::size_t) range check: i (which is {}) >= this->size() (which is {})",
+                        i, this->size()));
+            }
+
+            return payloads_[i];
+        }
+
         /**
          * @brief Returns the rank of the root process.
          * @return the root rank
@@ -1232,6 +1331,7 @@ namespace mpicxx {
          *
          * @calls{
          * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (only if a payload has been set)
          * }
          */
         spawn_result spawn() {
@@ -1271,11 +1371,300 @@ namespace mpicxx {
          *
          * @calls{
          * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (only if a payload has been set)
          * }
          */
         spawn_result_with_errcodes spawn_with_errcodes() {
             return this->spawn_impl<spawn_result_with_errcodes>();
         }
+        /**
+         * @brief Asynchronously spawns a number of MPI processes associated with multiple executables according to the previously set
+         *        options.
+         * @details The options are frozen (see @ref freeze() const) on the calling thread and the spawn is performed on a helper thread
+         *          such that the calling thread can continue with its own work while the new processes are launched. Later changes to this
+         *          @ref mpicxx::multiple_spawner don't affect the pending spawn. \n
+         *          Since [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) is collective over
+         *          the communicator, **all** processes in it must call this function. The returned @ref mpicxx::spawn_result object
+         *          **only** contains the intercommunicator.
+         * @return the future result of the spawn invocation
+         * @nodiscard
+         *
+         * @pre The number of executables **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre All executable name **must not** be empty.
+         * @pre The number of command line argument lists **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre All command line arguments **must not** be empty.
+         * @pre The number of maxprocs **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre All maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre The total number of maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre The number of spawn info **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre root **must not** be less than `0` and greater or equal than the size of the communicator (set via
+         *      @ref set_communicator(MPI_Comm) or default
+         *      [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)).
+         * @pre comm **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If **any** size mismatches. \n
+         *                       If any executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If any number of maxprocs is invalid. \n
+         *                       If the total number of maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);                  // exactly once
+         * int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most 'this->size()' times
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        [[nodiscard]]
+        std::future<spawn_result> spawn_async() const {
+            return this->spawn_async_impl<spawn_result>();
+        }
+        /**
+         * @brief Asynchronously spawns a number of MPI processes associated with multiple executables according to the previously set
+         *        options.
+         * @details The options are frozen (see @ref freeze() const) on the calling thread and the spawn is performed on a helper thread
+         *          such that the calling thread can continue with its own work while the new processes are launched. Later changes to this
+         *          @ref mpicxx::multiple_spawner don't affect the pending spawn. \n
+         *          Since [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) is collective over
+         *          the communicator, **all** processes in it must call this function. The returned @ref mpicxx::spawn_result_with_errcodes object
+         *          contains the intercommunicator **and** information about the possibly occurring error codes.
+         * @return the future result of the spawn invocation
+         * @nodiscard
+         *
+         * @pre The number of executables **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre All executable name **must not** be empty.
+         * @pre The number of command line argument lists **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre All command line arguments **must not** be empty.
+         * @pre The number of maxprocs **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre All maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre The total number of maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre The number of spawn info **must** match the size of this @ref mpicxx::multiple_spawner.
+         * @pre root **must not** be less than `0` and greater or equal than the size of the communicator (set via
+         *      @ref set_communicator(MPI_Comm) or default
+         *      [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)).
+         * @pre comm **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If **any** size mismatches. \n
+         *                       If any executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If any number of maxprocs is invalid. \n
+         *                       If the total number of maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);                  // exactly once
+         * int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most 'this->size()' times
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        [[nodiscard]]
+        std::future<spawn_result_with_errcodes> spawn_async_with_errcodes() const {
+            return this->spawn_async_impl<spawn_result_with_errcodes>();
+        }
+        /**
+         * @brief Freezes the current options into a reusable @ref mpicxx::prepared_spawn object.
+         * @details All executable names and command line arguments are copied into one contiguous arena and the pointer tables needed by
+         *          [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) are built exactly once.
+         *          Therefore, repeatedly spawning the same process layout via @ref mpicxx::prepared_spawn::spawn() doesn't perform any
+         *          conversion or memory allocation. \n
+         *          Later changes to this @ref mpicxx::multiple_spawner aren't reflected in the returned object.
+         *
+         *    Example: @snippet examples/startup/multiple_spawner.cpp freeze
+         * @return the frozen spawn options
+         * @nodiscard
+         *
+         * @pre The same preconditions as for @ref spawn() apply.
+         *
+         * @assert_precondition{ If **any** size mismatches. \n
+         *                       If any executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If any number of maxprocs is invalid. \n
+         *                       If the total number of maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         *
+         * @calls{ int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most 'this->size()' times }
+         */
+        [[nodiscard]]
+        prepared_spawn freeze() const {
+            this->assert_spawn_preconditions();
+
+            return prepared_spawn(commands_, argvs_, maxprocs_, info_, payloads_, root_, comm_);
+        }
+        /**
+         * @brief Hierarchically spawns a number of MPI processes associated with multiple executables according to the previously set
+         *        options using **all** processes of the communicator (at most @ref total_maxprocs()) as roots.
+         * @details See @ref spawn_hierarchical(const int).
+         * @return the result of the spawn invocation
+         *
+         * @pre The same preconditions as for @ref spawn() apply.
+         *
+         * @assert_precondition{ If **any** size mismatches. \n
+         *                       If any executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If any number of maxprocs is invalid. \n
+         *                       If the total number of maxprocs is invalid. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         */
+        spawn_result spawn_hierarchical() {
+            mpicxx::ensure_initialized();
+
+            int size;
+            MPI_Comm_size(comm_, &size);
+            return this->spawn_hierarchical(std::min(size, this->total_maxprocs()));
+        }
+        /**
+         * @brief Hierarchically spawns a number of MPI processes associated with multiple executables according to the previously set
+         *        options using the first @p number_of_roots processes of the communicator as roots.
+         * @details Instead of funneling the whole spawn through **one** root process, all processes to spawn are split into
+         *          @p number_of_roots contiguous chunks. The chunks are spawned concurrently by the first @p number_of_roots processes of
+         *          the communicator via [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm)
+         *          on [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). Afterwards, the resulting
+         *          intercommunicators are stitched together in a binary tree (`log2(comm size)` rounds) into **one** intercommunicator
+         *          between **all** spawning and **all** spawned processes. Therefore, the spawn time grows with the chunk size and only
+         *          logarithmically with the number of roots. \n
+         *          Since the spawn is collective over the communicator, **all** processes in it must call this function. Contrary to
+         *          @ref spawn(), the spawn options must be set on **all** root processes (the root set via @ref set_root(const int) is
+         *          ignored). The spawned processes **must** call @ref mpicxx::join_hierarchical_spawn() (after
+         *          @ref mpicxx::receive_payload() if a payload has been set). The spawned processes of one chunk share their
+         *          *MPI_COMM_WORLD*, @ref mpicxx::hierarchical_spawn_context::world contains **all** spawned processes (ordered as in
+         *          this @ref mpicxx::multiple_spawner). \n
+         *          The returned @ref mpicxx::spawn_result object **only** contains the stitched intercommunicator. Its local group is
+         *          ordered like the communicator, its remote group like the @ref mpicxx::hierarchical_spawn_context::world. Since
+         *          the processes, which didn't spawn a chunk themselves, are only connected to the spawned processes via the stitched
+         *          intercommunicator, it **must** be disconnected via
+         *          [*MPI_Comm_disconnect*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node247.htm) (on both sides) before
+         *          finalizing the MPI environment.
+         *
+         *    Example: @snippet examples/startup/multiple_spawner.cpp spawn hierarchical
+         * @param[in] number_of_roots the number of processes which spawn concurrently
+         * @return the result of the spawn invocation
+         *
+         * @pre The same preconditions as for @ref spawn() apply.
+         * @pre @p number_of_roots **must not** be less or equal than `0` or greater than the size of the communicator or
+         *      @ref total_maxprocs().
+         *
+         * @assert_precondition{ If **any** size mismatches. \n
+         *                       If any executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If any number of maxprocs is invalid. \n
+         *                       If the total number of maxprocs is invalid. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). \n
+         *                       If @p number_of_roots is invalid. }
+         *
+         * @calls{
+         * int MPI_Comm_dup(MPI_Comm comm, MPI_Comm *newcomm);                                                                                       // at most twice
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // at most once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);                 // at most 'chunk size' times (only if a payload has been set)
+         * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);                                                            // at most 'log2(comm size) + 1' times
+         * int MPI_Intercomm_create(MPI_Comm local_comm, int local_leader, MPI_Comm peer_comm, int remote_leader, int tag, MPI_Comm *newintercomm);    // at most 'log2(comm size) + 1' times
+         * int MPI_Comm_split(MPI_Comm comm, int color, int key, MPI_Comm *newcomm);                                                                  // exactly once
+         * }
+         */
+        spawn_result spawn_hierarchical(const int number_of_roots) {
+            mpicxx::ensure_initialized();
+            this->assert_hierarchical_spawn_preconditions(number_of_roots);
+
+            spawn_result res(this->total_maxprocs());
+            res.timings_.marshalling_begin = clock::now();
+
+            int rank, size;
+            MPI_Comm_rank(comm_, &rank);
+            MPI_Comm_size(comm_, &size);
+
+            // the group of this process and its spawned processes
+            MPI_Comm group;
+            if (rank < number_of_roots) {
+                // determine the chunk [first, last) of all processes this root is responsible for
+                const auto total = static_cast<long long>(this->total_maxprocs());
+                const auto first = static_cast<int>(total * rank / number_of_roots);
+                const auto last = static_cast<int>(total * (rank + 1) / number_of_roots);
+
+                // split the chunk into the parts of the executables
+                std::vector<char*> commands_ptr;
+                std::vector<std::size_t> argvs_idx;
+                std::vector<int> maxprocs;
+                std::vector<MPI_Info> info_ptr;
+                std::vector<const spawn_payload_type*> payloads_ptr;
+                int offset = 0;
+                for (std::size_t i = 0; i < this->size(); ++i) {
+                    const int begin = std::max(first, offset);
+                    const int end = std::min(last, offset + maxprocs_[i]);
+                    if (begin < end) {
+                        commands_ptr.emplace_back(commands_[i].data());
+                        argvs_idx.emplace_back(i);
+                        maxprocs.emplace_back(end - begin);
+                        info_ptr.emplace_back(info_[i].get());
+                        payloads_ptr.emplace_back(payloads_[i].has_value() ? &payloads_[i].value() : nullptr);
+                    }
+                    offset += maxprocs_[i];
+                }
+
+                // convert the command line arguments of the parts to char***
+                std::vector<char*> ptr;
+                for (const std::size_t i : argvs_idx) {
+                    for (std::string& str : argvs_[i]) {
+                        ptr.emplace_back(str.data());
+                    }
+                    ptr.emplace_back(nullptr);
+                }
+                std::vector<char**> argv_ptr;
+                argv_ptr.reserve(argvs_idx.size());
+                std::size_t idx = 0;
+                for (const std::size_t i : argvs_idx) {
+                    argv_ptr.emplace_back(&ptr[idx]);
+                    idx += argvs_[i].size() + 1;
+                }
+
+                res.timings_.marshalling_end = clock::now();
+                MPI_Comm intercomm;
+                MPI_Comm_spawn_multiple(static_cast<int>(commands_ptr.size()), commands_ptr.data(), argv_ptr.data(), maxprocs.data(),
+                                        info_ptr.data(), 0, MPI_COMM_SELF, &intercomm, MPI_ERRCODES_IGNORE);
+
+                // hand off the payloads to the spawned processes
+                if (std::any_of(payloads_ptr.cbegin(), payloads_ptr.cend(), [](const auto* payload) { return payload != nullptr; })) {
+                    detail::send_spawn_payloads(intercomm, 0, MPI_COMM_SELF, payloads_ptr, maxprocs, nullptr);
+                }
+
+                // the spawning process is ordered before its spawned processes
+                MPI_Intercomm_merge(intercomm, 0, &group);
+                MPI_Comm_free(&intercomm);
+            } else {
+                // this process doesn't spawn any processes
+                res.timings_.marshalling_end = clock::now();
+                MPI_Comm_dup(MPI_COMM_SELF, &group);
+            }
+
+            // stitch the groups together in a binary tree (on a duplicate to not interfere with other messages on the communicator)
+            MPI_Comm peer;
+            MPI_Comm_dup(comm_, &peer);
+            detail::hierarchical_spawn_lead(group, rank, size, peer);
+            MPI_Comm_free(&peer);
+
+            auto [intercomm, local] = detail::hierarchical_spawn_split(group, false);
+            MPI_Comm_free(&local);
+            res.intercomm_ = intercomm;
+            res.timings_.spawn_end = clock::now();
+
+            return res;
+        }
         ///@}
 
 
@@ -1311,44 +1700,29 @@ namespace mpicxx {
          *
          * @calls{
          * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (only if a payload has been set)
          * }
          */
         template <typename return_type>
         return_type spawn_impl() {
-            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(commands_),
-                    "Illegal number of values: commands_.size() (which is {}) != this->size() (which is {})",
-                    commands_.size(), this->size());
-            MPICXX_ASSERT_PRECONDITION(this->legal_command(commands_).first,
-                    "Attempt to use the {}-th executable name which is only an empty string!", this->legal_command(commands_).second);
-            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(argvs_),
-                    "illegal number of values: argvs_.size() (which is {}) != this->size() (which is {})",
-                    argvs_.size(), this->size());
-            MPICXX_ASSERT_PRECONDITION(this->legal_argv(argvs_), "Attempt to use an empty command line argument!",);
-            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(maxprocs_),
-                    "Illegal number of values: maxprocs_.size() (which is {}) != this->size() (which is {})",
-                    maxprocs_.size(), this->size());
-            MPICXX_ASSERT_PRECONDITION(this->legal_maxprocs(maxprocs_).first,
-                    "Attempt to use the {}-th maxprocs value (which is {}), which falls outside the valid range (0, {}]!",
-                    this->legal_maxprocs(maxprocs_).second, maxprocs_[this->legal_maxprocs(maxprocs_).second],
-                    mpicxx::universe_size().value_or(std::numeric_limits<int>::max()));
-            MPICXX_ASSERT_PRECONDITION(this->legal_maxprocs(this->total_maxprocs()),
-                    "Attempt to use the total number of maxprocs (which is: {} = {}), which falls outside the valid range (0, {}]!",
-                    fmt::join(maxprocs_, " + "), this->total_maxprocs(),
-                    mpicxx::universe_size().value_or(std::numeric_limits<int>::max()));
-            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(info_),
-                    "Illegal number of values: info_.size() (which is {}) != this->size() (which is {})",
-                    info_.size(), this->size());
-            MPICXX_ASSERT_PRECONDITION(this->legal_root(root_, comm_),
-                    "The previously set root '{}' isn't a valid root in the current communicator!", root_);
-            MPICXX_ASSERT_PRECONDITION(this->legal_communicator(comm_), "Can't use the  null communicator!");
+            mpicxx::ensure_initialized();
+            this->assert_spawn_preconditions();
 
             return_type res(this->total_maxprocs());
+            res.timings_.marshalling_begin = clock::now();
 
             // determine whether the placeholder MPI_ERRCODES_IGNORE shall be used or a "real" std::vector
-            auto errcode = [&res]() {
+            // (the error codes are always needed to map the spawned processes to their executables if any payload has been set)
+            const bool has_payload = std::any_of(payloads_.cbegin(), payloads_.cend(), [](const auto& payload) { return payload.has_value(); });
+            std::vector<int> payload_errcodes;
+            int* errcode = [&]() {
                 if constexpr (std::is_same_v<return_type, spawn_result_with_errcodes>) {
                     return res.errcodes_.data();
                 } else {
+                    if (has_payload) {
+                        payload_errcodes.resize(this->total_maxprocs());
+                        return payload_errcodes.data();
+                    }
                     return MPI_ERRCODES_IGNORE;
                 }
             }();
@@ -1368,14 +1742,15 @@ namespace mpicxx {
 
             if (std::all_of(argvs_.cbegin(), argvs_.cend(), [](const auto& vec) { return vec.empty(); })) {
                 // no additional arguments provided -> use MPI_ARGVS_NULL
+                res.timings_.marshalling_end = clock::now();
                 MPI_Comm_spawn_multiple(static_cast<int>(this->size()), commands_ptr.data(), MPI_ARGVS_NULL, maxprocs_.data(),
                                         info_ptr.data(), root_, comm_, &res.intercomm_, errcode);
             } else {
                 // convert command line arguments to char***
 
                 // get total number of command line arguments including nullptr
-                const std::size_t total_size = std::accumulate(argvs_.cbegin(), argvs_.cend(), 0,
-                        [](std::size_t sum, const std::vector<std::string>& vec) { return sum + vec.size(); });
+                const std::size_t total_size = std::accumulate(argvs_.cbegin(), argvs_.cend(), std::size_t{ 0 },
+                        [](std::size_t sum, const std::vector<std::string>& vec) { return sum + vec.size() + 1; });
                 // convert vector of vectors of strings to flat vector of char*
                 std::vector<char*> ptr(total_size);
                 std::size_t idx = 0;
@@ -1394,13 +1769,105 @@ namespace mpicxx {
                     idx += argvs_[i].size() + 1;
                 }
 
+                res.timings_.marshalling_end = clock::now();
                 MPI_Comm_spawn_multiple(static_cast<int>(this->size()), commands_ptr.data(), argv_ptr.data(), maxprocs_.data(),
                                         info_ptr.data(), root_, comm_, &res.intercomm_, errcode);
             }
+            res.timings_.spawn_end = clock::now();
+
+            // hand off the payloads to the spawned processes
+            if (has_payload) {
+                detail::send_spawn_payloads(res.intercomm_, root_, comm_, payloads_, maxprocs_, errcode);
+            }
 
             return res;
         }
 
+        /*
+         * @brief Asynchronously spawns a number of MPI processes associated with multiple executables on a helper thread according to the
+         *        previously set options.
+         * @details The options are frozen on the calling thread (which also checks all preconditions), the helper thread owns the
+         *          resulting @ref mpicxx::prepared_spawn object.
+         * @tparam return_type either @ref mpicxx::spawn_result or @ref mpicxx::spawn_result_with_errcodes
+         * @return the future result of the spawn invocation
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);                  // exactly once
+         * int MPI_Info_dup(MPI_info info, MPI_info *newinfo);    // at most 'this->size()' times
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        template <typename return_type>
+        std::future<return_type> spawn_async_impl() const {
+            // MPI_Comm_spawn_multiple gets called from a thread other than the main thread
+            mpicxx::require_thread_support(thread_support::multiple);
+
+            return std::async(std::launch::async, [ps = this->freeze()]() {
+                if constexpr (std::is_same_v<return_type, spawn_result_with_errcodes>) {
+                    return ps.spawn_with_errcodes();
+                } else {
+                    return ps.spawn();
+                }
+            });
+        }
+
+        /*
+         * @brief Checks all preconditions of @ref spawn_impl(), @ref freeze() const and @ref spawn_async_impl() const.
+         *
+         * @assert_precondition{ If **any** size mismatches. \n
+         *                       If any executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If any number of maxprocs is invalid. \n
+         *                       If the total number of maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         */
+        void assert_spawn_preconditions() const {
+            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(commands_),
+                    "Illegal number of values: commands_.size() (which is {}) != this->size() (which is {})",
+                    commands_.size(), this->size());
+            MPICXX_ASSERT_PRECONDITION(this->legal_command(commands_).first,
+                    "Attempt to use the {}-th executable name which is only an empty string!", this->legal_command(commands_).second);
+            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(argvs_),
+                    "illegal number of values: argvs_.size() (which is {}) != this->size() (which is {})",
+                    argvs_.size(), this->size());
+            MPICXX_ASSERT_PRECONDITION(this->legal_argv(argvs_), "Attempt to use an empty command line argument!",);
+            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(maxprocs_),
+                    "Illegal number of values: maxprocs_.size() (which is {}) != this->size() (which is {})",
+                    maxprocs_.size(), this->size());
+            MPICXX_ASSERT_PRECONDITION(this->legal_maxprocs(maxprocs_).first,
+                    "Attempt to use the {}-th maxprocs value (which is {}), which falls outside the valid range (0, {}]!",
+                    this->legal_maxprocs(maxprocs_).second, maxprocs_[this->legal_maxprocs(maxprocs_).second],
+                    mpicxx::universe_size().value_or(std::numeric_limits<int>::max()));
+            MPICXX_ASSERT_PRECONDITION(this->legal_maxprocs(this->total_maxprocs()),
+                    "Attempt to use the total number of maxprocs (which is: {} = {}), which falls outside the valid range (0, {}]!",
+                    fmt::join(maxprocs_, " + "), this->total_maxprocs(),
+                    mpicxx::universe_size().value_or(std::numeric_limits<int>::max()));
+            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_values(info_),
+                    "Illegal number of values: info_.size() (which is {}) != this->size() (which is {})",
+                    info_.size(), this->size());
+            MPICXX_ASSERT_PRECONDITION(this->legal_root(root_, comm_),
+                    "The previously set root '{}' isn't a valid root in the current communicator!", root_);
+            MPICXX_ASSERT_PRECONDITION(this->legal_communicator(comm_), "Can't use the  null communicator!");
+        }
+        /*
+         * @brief Checks all preconditions of @ref spawn_hierarchical(const int).
+         * @param[in] number_of_roots the number of processes which spawn concurrently
+         *
+         * @assert_precondition{ If any precondition of @ref assert_spawn_preconditions() const is violated. \n
+         *                       If @p number_of_roots is invalid. }
+         */
+        void assert_hierarchical_spawn_preconditions([[maybe_unused]] const int number_of_roots) const {
+            this->assert_spawn_preconditions();
+            MPICXX_ASSERT_PRECONDITION(this->legal_number_of_roots(number_of_roots),
+                    "Attempt to use {} roots, which falls outside the valid range (0, {}]!",
+                    number_of_roots, std::min(this->comm_size(comm_), this->total_maxprocs()));
+        }
+
 #if MPICXX_ASSERTION_LEVEL > 0
         /*
          * @brief Checks whether the sizes of the iterator ranges [@p first1, @p last1) and [@p first2, @p last2) are equal.
@@ -1457,7 +1924,7 @@ namespace mpicxx {
          * @return `true` if both sizes are equal, `false` otherwise
          */
         template <typename T>
-        bool legal_number_of_values(std::vector<T>& vec) const {
+        bool legal_number_of_values(const std::vector<T>& vec) const {
             return vec.size() == this->size();
         }
         /*
@@ -1536,7 +2003,7 @@ namespace mpicxx {
          * @return `true` if @p maxprocs is legal, `false` otherwise
          */
         bool legal_maxprocs(const int maxprocs) const {
-            std::optional<int> universe_size = mpicxx::universe_size();
+            const std::optional<int>& universe_size = mpicxx::runtime_info().universe_size;
             if (universe_size.has_value()) {
                 return 0 < maxprocs && maxprocs <= universe_size.value();
             } else {
@@ -1584,6 +2051,15 @@ namespace mpicxx {
         bool legal_communicator(const MPI_Comm comm) const noexcept {
             return comm != MPI_COMM_NULL;
         }
+        /*
+         * @brief Checks whether @p number_of_roots is valid, i.e. it is greater than `0` and neither greater than the size of the
+         *        communicator nor the total number of processes to spawn.
+         * @param[in] number_of_roots the number of processes which spawn concurrently
+         * @return `true` if @p number_of_roots is legal, `false` otherwise
+         */
+        bool legal_number_of_roots(const int number_of_roots) const {
+            return 0 < number_of_roots && number_of_roots <= std::min(this->comm_size(comm_), this->total_maxprocs());
+        }
 #endif
 
         size_type size_ = 0;
@@ -1591,6 +2067,7 @@ namespace mpicxx {
         std::vector<std::vector<std::string>> argvs_;
         std::vector<int> maxprocs_;
         std::vector<info> info_;
+        std::vector<std::optional<spawn_payload_type>> payloads_;
         int root_ = 0;
         MPI_Comm comm_ = MPI_COMM_WORLD;
     };
@@ -0,0 +1,353 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a frozen, reusable [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm)
+ *        invocation created by @ref mpicxx::multiple_spawner::freeze() const.
+ */
+
+#ifndef MPICXX_PREPARED_SPAWN_HPP
+#define MPICXX_PREPARED_SPAWN_HPP
+
+#include <mpicxx/chrono/clock.hpp>
+#include <mpicxx/info/info.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/spawn_payload.hpp>
+#include <mpicxx/startup/spawn_result.hpp>
+#include <mpicxx/startup/thread_support.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mpicxx {
+
+    /**
+     * @nosubgrouping
+     * @brief A frozen snapshot of a @ref mpicxx::multiple_spawner which can be used to repeatedly spawn the same process layout.
+     * @details All executable names and command line arguments are laid out in **one** contiguous, null-terminated character arena.
+     *          The pointer tables passed to [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm)
+     *          are built once and remain stable (also if the @ref mpicxx::prepared_spawn object is moved), such that subsequent calls
+     *          to @ref spawn() don't perform any conversion or memory allocation (except for the returned error codes in
+     *          @ref spawn_with_errcodes()). \n
+     *          Later changes to the originating @ref mpicxx::multiple_spawner aren't reflected in the @ref mpicxx::prepared_spawn object.
+     */
+    class prepared_spawn {
+        // befriend mpicxx::multiple_spawner
+        friend class mpicxx::multiple_spawner;
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                constructor                                                 //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /*
+         * @brief Construct a new prepared_spawn object by copying all spawn options into the arena.
+         * @param[in] commands the executable names
+         * @param[in] argvs the command line arguments for each executable
+         * @param[in] maxprocs the maximum number of processes for each executable
+         * @param[in] spawn_info the spawn info for each executable
+         * @param[in] payloads the payload for each executable
+         * @param[in] root the root process
+         * @param[in] comm the intracommunicator
+         */
+        prepared_spawn(const std::vector<std::string>& commands, const std::vector<std::vector<std::string>>& argvs,
+                       const std::vector<int>& maxprocs, const std::vector<info>& spawn_info,
+                       const std::vector<std::optional<spawn_payload_type>>& payloads, const int root, const MPI_Comm comm)
+                : maxprocs_(maxprocs), spawn_info_(spawn_info), payloads_(payloads), root_(root), comm_(comm)
+        {
+            // calculate the size of the arena and the number of command line arguments (including the terminating nullptrs)
+            std::size_t chars = 0;
+            std::size_t total_argvs = 0;
+            bool has_argvs = false;
+            for (std::size_t i = 0; i < commands.size(); ++i) {
+                chars += commands[i].size() + 1;
+                for (const std::string& arg : argvs[i]) {
+                    chars += arg.size() + 1;
+                }
+                total_argvs += argvs[i].size() + 1;
+                has_argvs = has_argvs || !argvs[i].empty();
+            }
+
+            arena_ = std::make_unique_for_overwrite<char[]>(chars);
+            char* ptr = arena_.get();
+            const auto copy = [&ptr](const std::string& str) {
+                char* begin = ptr;
+                std::memcpy(ptr, str.c_str(), str.size() + 1);
+                ptr += str.size() + 1;
+                return begin;
+            };
+
+            // lay out all executable names
+            commands_ptr_.reserve(commands.size());
+            for (const std::string& command : commands) {
+                commands_ptr_.push_back(copy(command));
+            }
+
+            // lay out all command line arguments (only if at least one executable has command line arguments)
+            if (has_argvs) {
+                argv_flat_.reserve(total_argvs);
+                for (const std::vector<std::string>& vec : argvs) {
+                    for (const std::string& arg : vec) {
+                        argv_flat_.push_back(copy(arg));
+                    }
+                    argv_flat_.push_back(nullptr);
+                }
+                argv_ptr_.reserve(argvs.size());
+                std::size_t idx = 0;
+                for (const std::vector<std::string>& vec : argvs) {
+                    argv_ptr_.push_back(argv_flat_.data() + idx);
+                    idx += vec.size() + 1;
+                }
+            }
+
+            // gather the MPI_Info handles
+            info_ptr_.reserve(spawn_info_.size());
+            for (const info& i : spawn_info_) {
+                info_ptr_.push_back(i.get());
+            }
+
+            for (const int i : maxprocs_) {
+                total_maxprocs_ += i;
+            }
+            has_payload_ = std::any_of(payloads_.cbegin(), payloads_.cend(), [](const auto& payload) { return payload.has_value(); });
+        }
+
+
+    public:
+        /**
+         * @brief Move constructor. All pointer tables remain valid.
+         */
+        prepared_spawn(prepared_spawn&&) = default;
+        /**
+         * @brief Move assignment operator. All pointer tables remain valid.
+         */
+        prepared_spawn& operator=(prepared_spawn&&) = default;
+        /**
+         * @brief Deleted copy constructor (the pointer tables refer to the own arena).
+         */
+        prepared_spawn(const prepared_spawn&) = delete;
+        /**
+         * @brief Deleted copy assignment operator (the pointer tables refer to the own arena).
+         */
+        prepared_spawn& operator=(const prepared_spawn&) = delete;
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                            spawn new process(es)                                           //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name spawn new process(es)
+        ///@{
+        /**
+         * @brief Spawns a number of MPI processes associated with multiple executables according to the frozen options.
+         * @details The returned @ref mpicxx::spawn_result object **only** contains the intercommunicator. No memory is allocated (except for
+         *          the internally needed error codes if any payload has been set).
+         * @return the result of the spawn invocation
+         *
+         * @calls{
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (only if a payload has been set)
+         * }
+         */
+        spawn_result spawn() const {
+            spawn_result res(total_maxprocs_);
+            this->spawn_impl(&res.intercomm_, MPI_ERRCODES_IGNORE, res.timings_);
+            return res;
+        }
+        /**
+         * @brief Spawns a number of MPI processes associated with multiple executables according to the frozen options.
+         * @details The returned @ref mpicxx::spawn_result_with_errcodes object contains the intercommunicator **and** information about the
+         *          possibly occurring error codes. The only memory allocation is the one of the error codes.
+         * @return the result of the spawn invocation
+         *
+         * @calls{
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (only if a payload has been set)
+         * }
+         */
+        spawn_result_with_errcodes spawn_with_errcodes() const {
+            spawn_result_with_errcodes res(total_maxprocs_);
+            this->spawn_impl(&res.intercomm_, res.errcodes_.data(), res.timings_);
+            return res;
+        }
+        /**
+         * @brief Asynchronously spawns a number of MPI processes associated with multiple executables according to the frozen options.
+         * @details The spawn is performed on a helper thread such that the calling thread can continue with its own work while the new
+         *          processes are launched. The returned @ref mpicxx::spawn_result object **only** contains the intercommunicator.
+         * @return the future result of the spawn invocation
+         * @nodiscard
+         *
+         * @pre This @ref mpicxx::prepared_spawn object **must** outlive the returned future's result retrieval.
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);    // exactly once
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        [[nodiscard]]
+        std::future<spawn_result> spawn_async() const {
+            mpicxx::require_thread_support(thread_support::multiple);
+            return std::async(std::launch::async, [this]() { return this->spawn(); });
+        }
+        /**
+         * @brief Asynchronously spawns a number of MPI processes associated with multiple executables according to the frozen options.
+         * @details The spawn is performed on a helper thread such that the calling thread can continue with its own work while the new
+         *          processes are launched. The returned @ref mpicxx::spawn_result_with_errcodes object contains the intercommunicator
+         *          **and** information about the possibly occurring error codes.
+         * @return the future result of the spawn invocation
+         * @nodiscard
+         *
+         * @pre This @ref mpicxx::prepared_spawn object **must** outlive the returned future's result retrieval.
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);    // exactly once
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'this->total_maxprocs()' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        [[nodiscard]]
+        std::future<spawn_result_with_errcodes> spawn_async_with_errcodes() const {
+            mpicxx::require_thread_support(thread_support::multiple);
+            return std::async(std::launch::async, [this]() { return this->spawn_with_errcodes(); });
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                   getter                                                   //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name getter
+        ///@{
+        /**
+         * @brief Returns the number of executables.
+         * @return the number of executables (**not** the total number of processes to spawn)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        std::size_t size() const noexcept { return commands_ptr_.size(); }
+        /**
+         * @brief Returns the total number of processes that will get spawned.
+         * @return the total number of processes
+         * @nodiscard
+         */
+        [[nodiscard]]
+        int total_maxprocs() const noexcept { return total_maxprocs_; }
+        /**
+         * @brief Returns the table of executable names passed to
+         *        [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm).
+         * @return pointer to the first of @ref size() null-terminated executable names
+         * @nodiscard
+         */
+        [[nodiscard]]
+        char* const* commands() const noexcept { return commands_ptr_.data(); }
+        /**
+         * @brief Returns the table of command line arguments passed to
+         *        [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm).
+         * @return pointer to the first of @ref size() nullptr-terminated command line argument lists or
+         *         [*MPI_ARGVS_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) if no executable has command line
+         *         arguments
+         * @nodiscard
+         */
+        [[nodiscard]]
+        char** const* argvs() const noexcept { return argv_ptr_.empty() ? MPI_ARGVS_NULL : argv_ptr_.data(); }
+        /**
+         * @brief Returns the maximum number of processes for each executable.
+         * @return the maxprocs
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const std::vector<int>& maxprocs() const noexcept { return maxprocs_; }
+        /**
+         * @brief Returns the spawn info for each executable.
+         * @return the spawn info
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const std::vector<info>& spawn_info() const noexcept { return spawn_info_; }
+        /**
+         * @brief Returns the payload handed off to the spawned processes of each executable.
+         * @return the payloads
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const std::vector<std::optional<spawn_payload_type>>& payload() const noexcept { return payloads_; }
+        /**
+         * @brief Returns the rank of the root process.
+         * @return the root rank
+         * @nodiscard
+         */
+        [[nodiscard]]
+        int root() const noexcept { return root_; }
+        /**
+         * @brief Returns the intracommunicator containing the group of spawning processes.
+         * @return the intracommunicator
+         * @nodiscard
+         */
+        [[nodiscard]]
+        MPI_Comm communicator() const noexcept { return comm_; }
+        ///@}
+
+
+    private:
+        /*
+         * @brief Calls [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) with the frozen
+         *        pointer tables and hands off the payloads (if any) to the spawned processes.
+         * @param[out] intercomm the resulting intercommunicator
+         * @param[out] errcodes the error codes or `MPI_ERRCODES_IGNORE`
+         * @param[out] timings the spawn timings
+         */
+        void spawn_impl(MPI_Comm* intercomm, int* errcodes, spawn_timings& timings) const {
+            mpicxx::ensure_initialized();
+
+            // the error codes are always needed to map the spawned processes to their executables if any payload has been set
+            std::vector<int> payload_errcodes;
+            if (has_payload_ && errcodes == MPI_ERRCODES_IGNORE) {
+                payload_errcodes.resize(total_maxprocs_);
+                errcodes = payload_errcodes.data();
+            }
+
+            // the spawn options have already been converted in the constructor -> no marshalling
+            timings.marshalling_begin = clock::now();
+            timings.marshalling_end = timings.marshalling_begin;
+            // MPI_Comm_spawn_multiple isn't const-correct
+            MPI_Comm_spawn_multiple(static_cast<int>(this->size()), const_cast<char**>(commands_ptr_.data()),
+                                    const_cast<char***>(this->argvs()), maxprocs_.data(), info_ptr_.data(),
+                                    root_, comm_, intercomm, errcodes);
+            timings.spawn_end = clock::now();
+
+            // hand off the payloads to the spawned processes
+            if (has_payload_) {
+                detail::send_spawn_payloads(*intercomm, root_, comm_, payloads_, maxprocs_, errcodes);
+            }
+        }
+
+        std::unique_ptr<char[]> arena_;
+        std::vector<char*> commands_ptr_;
+        std::vector<char*> argv_flat_;
+        std::vector<char**> argv_ptr_;
+        std::vector<int> maxprocs_;
+        std::vector<info> spawn_info_;
+        std::vector<MPI_Info> info_ptr_;
+        std::vector<std::optional<spawn_payload_type>> payloads_;
+        bool has_payload_ = false;
+        int total_maxprocs_ = 0;
+        int root_;
+        MPI_Comm comm_;
+    };
+
+}
+
+#endif // MPICXX_PREPARED_SPAWN_HPP
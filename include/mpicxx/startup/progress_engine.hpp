@@ -0,0 +1,469 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements an optional background thread driving the progress of nonblocking MPI operations.
+ */
+
+#ifndef MPICXX_PROGRESS_ENGINE_HPP
+#define MPICXX_PROGRESS_ENGINE_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/finalize.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/thread_support.hpp>
+
+#include <mpi.h>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mpicxx {
+
+    /**
+     * @brief The configuration of a @ref mpicxx::progress_engine.
+     * @details After each polling iteration the progress thread sleeps. The sleep duration starts at @ref polling_interval and is
+     *          multiplied by @ref backoff_factor after each iteration which didn't complete any request (up to @ref max_backoff). It is
+     *          reset to @ref polling_interval as soon as a request completes or a new request gets registered.
+     */
+    struct progress_engine_config {
+        /// The sleep duration after an iteration which completed a request (`0` only yields).
+        std::chrono::microseconds polling_interval{ 10 };
+        /// The maximum sleep duration after consecutive iterations which didn't complete any request.
+        std::chrono::microseconds max_backoff{ 1000 };
+        /// The factor the sleep duration gets multiplied by after an iteration which didn't complete any request.
+        double backoff_factor = 2.0;
+        /// `true` if each iteration additionally calls [*MPI_Iprobe*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node50.htm)
+        /// on @ref probe_communicator (driving the progress of incoming messages for which no receive has been posted yet).
+        bool probe = true;
+        /// The communicator probed if @ref probe is `true`.
+        MPI_Comm probe_communicator = MPI_COMM_WORLD;
+        /// The core the progress thread gets pinned to (e.g. a spare core not used by the compute threads), no pinning if not set.
+        std::optional<int> core;
+    };
+
+    /**
+     * @brief The statistics of a @ref mpicxx::progress_engine, i.e. how much progress has been made in the background.
+     */
+    struct progress_engine_statistics {
+        /// The number of polling iterations.
+        std::size_t iterations = 0;
+        /// The number of polling iterations which didn't complete any request.
+        std::size_t idle_iterations = 0;
+        /// The number of requests completed by the progress thread.
+        std::size_t completed_requests = 0;
+        /// The number of calls to [*MPI_Iprobe*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node50.htm).
+        std::size_t probes = 0;
+        /// The number of calls to [*MPI_Iprobe*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node50.htm) which found a message.
+        std::size_t probe_hits = 0;
+        /// The number of currently registered, not yet completed requests.
+        std::size_t pending_requests = 0;
+    };
+
+
+    class progress_engine;
+
+    namespace detail {
+
+        /// The configuration of the global @ref mpicxx::progress_engine started by @ref mpicxx::init() (if requested).
+        inline std::optional<progress_engine_config> progress_engine_on_init;
+        /// The global @ref mpicxx::progress_engine (if started).
+        inline std::unique_ptr<progress_engine> global_progress_engine;
+
+        /*
+         * @brief Starts the global progress engine if requested and @ref mpicxx::thread_support::multiple is provided.
+         * @param[in] provided the provided level of thread support
+         */
+        inline void start_global_progress_engine(thread_support provided);
+
+    }
+
+
+    /**
+     * @brief An optional background thread driving the progress of nonblocking MPI operations.
+     * @details Many MPI implementations only progress nonblocking operations inside of MPI calls. Therefore, the overlap of
+     *          communication and computation collapses if the computation doesn't call any MPI function for a long time. \n
+     *          The progress engine owns a thread repeatedly calling
+     *          [*MPI_Testsome*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node69.htm) on all registered requests (and
+     *          optionally [*MPI_Iprobe*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node50.htm)). The completion of a
+     *          registered request is reported through a [`std::future`](https://en.cppreference.com/w/cpp/thread/future). \n
+     *          Requires @ref mpicxx::thread_support::multiple. A global progress engine can be started by @ref mpicxx::init() via
+     *          @ref start_on_init(); it is stopped directly before [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)
+     *          (after all other callbacks registered via @ref mpicxx::atfinalize()).
+     *
+     *    Example: @snippet examples/startup/progress_engine.cpp progress engine
+     */
+    class progress_engine {
+    public:
+        /// Unsigned integer type.
+        using size_type = std::size_t;
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                        constructors and destructor                                         //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name constructors and destructor
+        ///@{
+        /**
+         * @brief Construct a new progress engine and start its progress thread.
+         * @param[in] config the configuration
+         *
+         * @pre The MPI environment **must** be active.
+         * @pre @p config.polling_interval and @p config.max_backoff **must not** be negative and @p config.max_backoff **must** be
+         *      greater or equal than @p config.polling_interval.
+         * @pre @p config.backoff_factor **must** be greater or equal than `1.0`.
+         * @pre If set, @p config.core **must** be non-negative.
+         *
+         * @assert_precondition{ If the MPI environment isn't active. \n
+         *                       If any configuration value is illegal. }
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support is less than
+         *         @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);    // exactly once
+         * + the MPI functions called by the progress thread (see the class description)
+         * }
+         */
+        explicit progress_engine(progress_engine_config config = progress_engine_config{}) : config_(std::move(config)) {
+            mpicxx::ensure_initialized();
+            MPICXX_ASSERT_PRECONDITION(mpicxx::active(), "The MPI environment must be active to start a progress engine!");
+            MPICXX_ASSERT_PRECONDITION(config_.polling_interval.count() >= 0,
+                    "Attempt to set a negative polling interval (which is {}us)!", config_.polling_interval.count());
+            MPICXX_ASSERT_PRECONDITION(config_.max_backoff >= config_.polling_interval,
+                    "Attempt to set a maximum backoff (which is {}us) less than the polling interval (which is {}us)!",
+                    config_.max_backoff.count(), config_.polling_interval.count());
+            MPICXX_ASSERT_PRECONDITION(config_.backoff_factor >= 1.0,
+                    "Attempt to set a backoff factor (which is {}) less than 1.0!", config_.backoff_factor);
+            MPICXX_ASSERT_PRECONDITION(!config_.core.has_value() || config_.core.value() >= 0,
+                    "Attempt to pin the progress thread to a negative core (which is {})!", config_.core.value_or(0));
+
+            mpicxx::require_thread_support(thread_support::multiple);
+
+            thread_ = std::thread(&progress_engine::run, this);
+            if (config_.core.has_value()) {
+                pinned_ = progress_engine::pin(thread_, config_.core.value());
+            }
+        }
+        /**
+         * @brief Deleted copy constructor.
+         */
+        progress_engine(const progress_engine&) = delete;
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        progress_engine& operator=(const progress_engine&) = delete;
+        /**
+         * @brief Destruct the progress engine, i.e. stops and joins its progress thread.
+         * @details All not yet completed requests are marked for deallocation (if the MPI environment is still active) and their futures
+         *          report a [`std::future_error`](https://en.cppreference.com/w/cpp/thread/future_error) (broken promise).
+         *
+         * @calls{ int MPI_Request_free(MPI_Request *request);    // exactly once for each not yet completed request }
+         */
+        ~progress_engine() {
+            {
+                std::scoped_lock lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_one();
+            thread_.join();
+
+            // adopt the requests registered after the last iteration
+            requests_.insert(requests_.end(), incoming_requests_.begin(), incoming_requests_.end());
+            if (mpicxx::active()) {
+                for (MPI_Request& request : requests_) {
+                    MPI_Request_free(&request);
+                }
+            }
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                               registration                                                 //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name registration
+        ///@{
+        /**
+         * @brief Hands the nonblocking request @p request over to the progress engine.
+         * @details The progress engine takes ownership of @p request, i.e. @p request **must not** be used (e.g. waited on or freed)
+         *          afterwards. Use the returned future instead. \n
+         *          Persistent requests aren't supported.
+         *
+         *    This function is thread safe.
+         * @param[in] request the nonblocking request
+         * @return the future receiving the status of the completed request
+         * @nodiscard
+         *
+         * @pre @p request **must not** be [*MPI_REQUEST_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node60.htm).
+         *
+         * @assert_precondition{ If @p request is *MPI_REQUEST_NULL*. }
+         */
+        [[nodiscard]]
+        std::future<MPI_Status> register_request(const MPI_Request request) {
+            MPICXX_ASSERT_PRECONDITION(request != MPI_REQUEST_NULL, "Attempt to register MPI_REQUEST_NULL!");
+
+            std::promise<MPI_Status> promise;
+            std::future<MPI_Status> future = promise.get_future();
+            {
+                std::scoped_lock lock(mutex_);
+                incoming_requests_.push_back(request);
+                incoming_promises_.push_back(std::move(promise));
+                ++pending_;
+            }
+            cv_.notify_one();
+            return future;
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                  getter                                                    //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name getter
+        ///@{
+        /**
+         * @brief Returns the configuration of the progress engine.
+         * @return the configuration
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const progress_engine_config& config() const noexcept { return config_; }
+        /**
+         * @brief Returns whether the progress thread has been successfully pinned to @ref progress_engine_config::core.
+         * @details Pinning is only supported on Linux.
+         * @return `true` if the progress thread has been pinned, `false` otherwise
+         * @nodiscard
+         */
+        [[nodiscard]]
+        bool pinned() const noexcept { return pinned_; }
+        /**
+         * @brief Returns a snapshot of the statistics of the progress engine.
+         * @details This function is thread safe.
+         * @return the statistics
+         * @nodiscard
+         */
+        [[nodiscard]]
+        progress_engine_statistics statistics() const noexcept {
+            progress_engine_statistics stats;
+            stats.iterations = iterations_.load(std::memory_order_relaxed);
+            stats.idle_iterations = idle_iterations_.load(std::memory_order_relaxed);
+            stats.completed_requests = completed_requests_.load(std::memory_order_relaxed);
+            stats.probes = probes_.load(std::memory_order_relaxed);
+            stats.probe_hits = probe_hits_.load(std::memory_order_relaxed);
+            stats.pending_requests = pending_.load(std::memory_order_relaxed);
+            return stats;
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                           global progress engine                                           //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name global progress engine
+        ///@{
+        /**
+         * @brief Requests the start of a global progress engine with the configuration @p config by the
+         *        @ref mpicxx::init(const thread_support) and @ref mpicxx::init(int&, char**, const thread_support) functions.
+         * @details The global progress engine is **only** started if @ref mpicxx::thread_support::multiple is provided. Otherwise,
+         *          @ref global() returns `nullptr`.
+         * @param[in] config the configuration of the global progress engine
+         *
+         * @pre The MPI environment **must not** be initialized.
+         *
+         * @assert_precondition{ If the MPI environment has already been initialized. }
+         *
+         * @calls{ int MPI_Initialized(int *flag);    // exactly once }
+         */
+        static void start_on_init(progress_engine_config config = progress_engine_config{}) {
+            MPICXX_ASSERT_PRECONDITION(!mpicxx::initialized(), "The global progress engine must be requested before initialization!");
+
+            detail::progress_engine_on_init = std::move(config);
+            detail::post_init_hook = &detail::start_global_progress_engine;
+        }
+        /**
+         * @brief Returns the global progress engine started by @ref mpicxx::init().
+         * @return the global progress engine or `nullptr` if it hasn't been started (or has already been stopped)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        static progress_engine* global() noexcept { return detail::global_progress_engine.get(); }
+        ///@}
+
+    private:
+        /*
+         * @brief The function executed by the progress thread.
+         *
+         * @calls{
+         * int MPI_Testsome(int incount, MPI_Request array_of_requests[], int *outcount, int array_of_indices[], MPI_Status array_of_statuses[]);    // exactly once per iteration with registered requests
+         * int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status);                                                          // exactly once per iteration if probing is enabled
+         * }
+         */
+        void run() {
+            std::vector<int> indices;
+            std::vector<MPI_Status> statuses;
+            std::chrono::microseconds delay = config_.polling_interval;
+
+            std::unique_lock lock(mutex_);
+            while (!stop_) {
+                // adopt the newly registered requests
+                const bool registered = !incoming_requests_.empty();
+                requests_.insert(requests_.end(), incoming_requests_.begin(), incoming_requests_.end());
+                std::move(incoming_promises_.begin(), incoming_promises_.end(), std::back_inserter(promises_));
+                incoming_requests_.clear();
+                incoming_promises_.clear();
+                lock.unlock();
+
+                // update the statistics before fulfilling any promise
+                ++iterations_;
+                this->probe_for_messages();
+                const size_type completed = this->test_requests(indices, statuses);
+                if (completed == 0) {
+                    ++idle_iterations_;
+                }
+                if (completed > 0 || registered) {
+                    delay = config_.polling_interval;
+                } else {
+                    const auto next = std::chrono::duration<double, std::micro>(delay) * config_.backoff_factor;
+                    delay = std::min(std::max(std::chrono::duration_cast<std::chrono::microseconds>(next), std::chrono::microseconds(1)),
+                                     config_.max_backoff);
+                }
+
+                lock.lock();
+                if (delay.count() == 0) {
+                    lock.unlock();
+                    std::this_thread::yield();
+                    lock.lock();
+                } else {
+                    // a new registration or the stop request wakes the progress thread immediately
+                    cv_.wait_for(lock, delay, [this]() { return stop_ || !incoming_requests_.empty(); });
+                }
+            }
+        }
+        /*
+         * @brief Tests all registered requests and fulfills the promises of the completed ones.
+         * @param[inout] indices scratch space for the indices of the completed requests
+         * @param[inout] statuses scratch space for the statuses of the completed requests
+         * @return the number of completed requests
+         */
+        size_type test_requests(std::vector<int>& indices, std::vector<MPI_Status>& statuses) {
+            if (requests_.empty()) {
+                return 0;
+            }
+            indices.resize(requests_.size());
+            statuses.resize(requests_.size());
+            int outcount;
+            MPI_Testsome(static_cast<int>(requests_.size()), requests_.data(), &outcount, indices.data(), statuses.data());
+            if (outcount == MPI_UNDEFINED || outcount == 0) {
+                return 0;
+            }
+
+            const auto completed = static_cast<size_type>(outcount);
+            completed_requests_ += completed;
+            pending_ -= completed;
+            for (int i = 0; i < outcount; ++i) {
+                promises_[indices[i]].set_value(statuses[i]);
+            }
+            // remove the completed requests (set to MPI_REQUEST_NULL by MPI_Testsome)
+            size_type last = 0;
+            for (size_type i = 0; i < requests_.size(); ++i) {
+                if (requests_[i] != MPI_REQUEST_NULL) {
+                    requests_[last] = requests_[i];
+                    promises_[last] = std::move(promises_[i]);
+                    ++last;
+                }
+            }
+            requests_.resize(last);
+            promises_.erase(promises_.begin() + last, promises_.end());
+            return completed;
+        }
+        /*
+         * @brief Probes the configured communicator for incoming messages (if enabled).
+         */
+        void probe_for_messages() {
+            if (config_.probe) {
+                int flag;
+                MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, config_.probe_communicator, &flag, MPI_STATUS_IGNORE);
+                ++probes_;
+                if (static_cast<bool>(flag)) {
+                    ++probe_hits_;
+                }
+            }
+        }
+        /*
+         * @brief Pins the thread @p t to the core @p core.
+         * @param[in] t the thread to pin
+         * @param[in] core the core
+         * @return `true` if the pinning succeeded, `false` otherwise (always `false` if not on Linux)
+         */
+        static bool pin([[maybe_unused]] std::thread& t, [[maybe_unused]] const int core) {
+#if defined(__linux__)
+            if (core >= CPU_SETSIZE) {
+                return false;
+            }
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            return pthread_setaffinity_np(t.native_handle(), sizeof(cpu_set_t), &set) == 0;
+#else
+            return false;
+#endif
+        }
+
+        const progress_engine_config config_;
+        bool pinned_ = false;
+
+        // guarded by mutex_
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_ = false;
+        std::vector<MPI_Request> incoming_requests_;
+        std::vector<std::promise<MPI_Status>> incoming_promises_;
+
+        // only accessed by the progress thread (and the destructor after joining)
+        std::vector<MPI_Request> requests_;
+        std::vector<std::promise<MPI_Status>> promises_;
+
+        std::atomic<size_type> iterations_ = 0;
+        std::atomic<size_type> idle_iterations_ = 0;
+        std::atomic<size_type> completed_requests_ = 0;
+        std::atomic<size_type> probes_ = 0;
+        std::atomic<size_type> probe_hits_ = 0;
+        std::atomic<size_type> pending_ = 0;
+
+        std::thread thread_;
+    };
+
+
+    namespace detail {
+
+        inline void start_global_progress_engine(const thread_support provided) {
+            if (progress_engine_on_init.has_value() && provided == thread_support::multiple) {
+                global_progress_engine = std::make_unique<progress_engine>(progress_engine_on_init.value());
+                // stop the progress engine after all other callbacks (which may still rely on the background progress)
+                mpicxx::atfinalize([]() { global_progress_engine.reset(); }, std::numeric_limits<atfinalize_registry::priority_type>::min());
+            }
+        }
+
+    }
+
+}
+
+#endif // MPICXX_PROGRESS_ENGINE_HPP
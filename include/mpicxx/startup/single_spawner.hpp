@@ -10,17 +10,25 @@
 #ifndef MPICXX_SINGLE_SPAWNER_HPP
 #define MPICXX_SINGLE_SPAWNER_HPP
 
+#include <mpicxx/chrono/clock.hpp>
 #include <mpicxx/detail/assert.hpp>
 #include <mpicxx/detail/concepts.hpp>
 #include <mpicxx/detail/conversion.hpp>
 #include <mpicxx/info/info.hpp>
 #include <mpicxx/info/runtime_info.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/spawn_payload.hpp>
 #include <mpicxx/startup/spawn_result.hpp>
+#include <mpicxx/startup/thread_support.hpp>
 
 #include <fmt/format.h>
 #include <mpi.h>
 
 #include <cstddef>
+#include <future>
+#include <limits>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -252,6 +260,35 @@ namespace mpicxx {
             comm_ = comm;
             return *this;
         }
+
+        /**
+         * @brief Set the payload handed off to **all** spawned processes (which receive it via @ref mpicxx::receive_payload()).
+         * @details Contrary to the command line arguments, the payload isn't converted to strings: it's sent as **one** message over the
+         *          intercommunicator created by the spawn. \n
+         *          The payload is only significant at the root process.
+         *
+         *    Example: @snippet examples/startup/single_spawner.cpp spawn with payload
+         * @param[in] payload the payload
+         * @return `*this`
+         *
+         * @pre The size of @p payload **must not** be greater than the maximum value representable by an `int`.
+         *
+         * @throws std::length_error if @p payload is too large
+         */
+        single_spawner& set_payload(const std::span<const std::byte> payload) {
+            detail::check_spawn_payload_size(payload.size());
+
+            payload_.emplace(payload.begin(), payload.end());
+            return *this;
+        }
+        /**
+         * @brief Removes the payload, i.e. nothing gets handed off to the spawned processes.
+         * @return `*this`
+         */
+        single_spawner& remove_payload() noexcept {
+            payload_.reset();
+            return *this;
+        }
         ///@}
 
 
@@ -336,6 +373,14 @@ namespace mpicxx {
          */
         [[nodiscard]]
         MPI_Comm communicator() const noexcept { return comm_; }
+
+        /**
+         * @brief Returns the payload handed off to the spawned processes.
+         * @return the payload or [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if no payload has been set
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const std::optional<spawn_payload_type>& payload() const noexcept { return payload_; }
         ///@}
 
 
@@ -369,6 +414,7 @@ namespace mpicxx {
          *
          * @calls{
          * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'maxprocs' times (only if a payload has been set)
          * }
          */
         spawn_result spawn() {
@@ -400,11 +446,90 @@ namespace mpicxx {
          *
          * @calls{
          * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'maxprocs' times (only if a payload has been set)
          * }
          */
         spawn_result_with_errcodes spawn_with_errcodes() {
             return this->spawn_impl<spawn_result_with_errcodes>();
         }
+        /**
+         * @brief Asynchronously spawns a number of MPI processes according to the previously set options.
+         * @details The spawn is performed on a helper thread such that the calling thread can continue with its own work while the new
+         *          processes are launched. The options are copied, i.e. later changes to this @ref mpicxx::single_spawner don't affect the
+         *          pending spawn. \n
+         *          Since [*MPI_Comm_spawn*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node237.htm) is collective over the
+         *          communicator, **all** processes in it must call this function. The returned @ref mpicxx::spawn_result object **only**
+         *          contains the intercommunicator.
+         * @return the future result of the spawn invocation
+         * @nodiscard
+         *
+         * @pre The executable name **must not** be empty.
+         * @pre All command line arguments **must not** be empty.
+         * @pre maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre root **must not** be less than `0` and greater or equal than the size of the communicator (set via
+         *      @ref set_communicator(MPI_Comm) or default
+         *      [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)).
+         * @pre comm **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);    // exactly once
+         * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'maxprocs' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        [[nodiscard]]
+        std::future<spawn_result> spawn_async() const {
+            return this->spawn_async_impl<spawn_result>();
+        }
+        /**
+         * @brief Asynchronously spawns a number of MPI processes according to the previously set options.
+         * @details The spawn is performed on a helper thread such that the calling thread can continue with its own work while the new
+         *          processes are launched. The options are copied, i.e. later changes to this @ref mpicxx::single_spawner don't affect the
+         *          pending spawn. \n
+         *          Since [*MPI_Comm_spawn*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node237.htm) is collective over the
+         *          communicator, **all** processes in it must call this function. The returned @ref mpicxx::spawn_result_with_errcodes
+         *          object contains the intercommunicator **and** information about the possibly occurring error codes.
+         * @return the future result of the spawn invocation
+         * @nodiscard
+         *
+         * @pre The executable name **must not** be empty.
+         * @pre All command line arguments **must not** be empty.
+         * @pre maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre root **must not** be less than `0` and greater or equal than the size of the communicator (set via
+         *      @ref set_communicator(MPI_Comm) or default
+         *      [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)).
+         * @pre comm **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);    // exactly once
+         * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'maxprocs' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        [[nodiscard]]
+        std::future<spawn_result_with_errcodes> spawn_async_with_errcodes() const {
+            return this->spawn_async_impl<spawn_result_with_errcodes>();
+        }
         ///@}
 
 
@@ -434,21 +559,16 @@ namespace mpicxx {
          *
          * @calls{
          * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'maxprocs' times (only if a payload has been set)
          * }
          */
         template <typename return_type>
         return_type spawn_impl() {
-            MPICXX_ASSERT_PRECONDITION(this->legal_command(command_), "Attempt to use the executable name which is only an empty string!");
-            MPICXX_ASSERT_PRECONDITION(this->legal_argv(argvs_).first,
-                    "Attempt to use the {}-th command line argument which is only an empty string!", this->legal_argv(argvs_).second);
-            MPICXX_ASSERT_PRECONDITION(this->legal_maxprocs(maxprocs_),
-                    "Attempt to use the maxprocs value (which is {}), which falls outside the valid range (0, {}]!",
-                    maxprocs_, mpicxx::universe_size().value_or(std::numeric_limits<int>::max()));
-            MPICXX_ASSERT_PRECONDITION(this->legal_root(root_, comm_),
-                    "The previously set root '{}' isn't a valid root in the current communicator!", root_);
-            MPICXX_ASSERT_PRECONDITION(this->legal_communicator(comm_), "Can't use the null communicator!");
+            mpicxx::ensure_initialized();
+            this->assert_spawn_preconditions();
 
             return_type res(maxprocs_);
+            res.timings_.marshalling_begin = clock::now();
 
             // determine whether the placeholder MPI_ERRCODES_IGNORE shall be used or a "real" std::vector
             auto errcode = [&res]() {
@@ -461,6 +581,7 @@ namespace mpicxx {
 
             if (argvs_.empty()) {
                 // no additional arguments provided -> use MPI_ARGV_NULL
+                res.timings_.marshalling_end = clock::now();
                 MPI_Comm_spawn(command_.c_str(), MPI_ARGV_NULL, maxprocs_, info_.get(),
                                root_, comm_, &res.intercomm_, errcode);
             } else {
@@ -473,12 +594,78 @@ namespace mpicxx {
                 // add null termination
                 argvs_ptr.emplace_back(nullptr);
 
+                res.timings_.marshalling_end = clock::now();
                 MPI_Comm_spawn(command_.c_str(), argvs_ptr.data(), maxprocs_, info_.get(),
                                root_, comm_, &res.intercomm_, errcode);
             }
+            res.timings_.spawn_end = clock::now();
+
+            // hand off the payload to the spawned processes
+            if (payload_.has_value()) {
+                const int* errcodes = nullptr;
+                if constexpr (std::is_same_v<return_type, spawn_result_with_errcodes>) {
+                    errcodes = res.errcodes_.data();
+                }
+                detail::send_spawn_payloads(res.intercomm_, root_, comm_, std::span(&payload_, 1), std::span(&maxprocs_, 1), errcodes);
+            }
             return res;
         }
 
+        /*
+         * @brief Asynchronously spawns a number of MPI processes on a helper thread according to the previously set options.
+         * @details The preconditions are checked on the calling thread, the helper thread operates on a copy of this
+         *          @ref mpicxx::single_spawner.
+         * @tparam return_type either @ref mpicxx::spawn_result or @ref mpicxx::spawn_result_with_errcodes
+         * @return the future result of the spawn invocation
+         *
+         * @throws mpicxx::thread_support_not_satisfied if the provided level of thread support isn't @ref mpicxx::thread_support::multiple
+         *
+         * @calls{
+         * int MPI_Query_thread(int *provided);    // exactly once
+         * int MPI_Comm_spawn(const char *command, char *argv[], int maxprocs, MPI_Info info, int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once (on the helper thread)
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most 'maxprocs' times (on the helper thread, only if a payload has been set)
+         * }
+         */
+        template <typename return_type>
+        std::future<return_type> spawn_async_impl() const {
+            // MPI_Comm_spawn gets called from a thread other than the main thread
+            mpicxx::require_thread_support(thread_support::multiple);
+            this->assert_spawn_preconditions();
+
+            return std::async(std::launch::async, [spawner = *this]() mutable { return spawner.spawn_impl<return_type>(); });
+        }
+
+        /*
+         * @brief Checks all preconditions of @ref spawn_impl() and @ref spawn_async_impl() const.
+         *
+         * @pre The executable name **must not** be empty.
+         * @pre All command line arguments **must not** be empty.
+         * @pre maxprocs **must not** be less or equal than `0` or greater than the maximum possible number of processes
+         *      (@ref mpicxx::universe_size()).
+         * @pre root **must not** be less than `0` and greater or equal than the size of the communicator (set via
+         *      @ref set_communicator(MPI_Comm) or default
+         *      [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)).
+         * @pre comm **must not** be [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the executable name is empty. \n
+         *                       If any command line argument is empty. \n
+         *                       If maxprocs is invalid. \n
+         *                       If root isn't a legal root. \n
+         *                       If comm is the null communicator
+         *                       ([*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm)). }
+         */
+        void assert_spawn_preconditions() const {
+            MPICXX_ASSERT_PRECONDITION(this->legal_command(command_), "Attempt to use the executable name which is only an empty string!");
+            MPICXX_ASSERT_PRECONDITION(this->legal_argv(argvs_).first,
+                    "Attempt to use the {}-th command line argument which is only an empty string!", this->legal_argv(argvs_).second);
+            MPICXX_ASSERT_PRECONDITION(this->legal_maxprocs(maxprocs_),
+                    "Attempt to use the maxprocs value (which is {}), which falls outside the valid range (0, {}]!",
+                    maxprocs_, mpicxx::universe_size().value_or(std::numeric_limits<int>::max()));
+            MPICXX_ASSERT_PRECONDITION(this->legal_root(root_, comm_),
+                    "The previously set root '{}' isn't a valid root in the current communicator!", root_);
+            MPICXX_ASSERT_PRECONDITION(this->legal_communicator(comm_), "Can't use the null communicator!");
+        }
+
 #if MPICXX_ASSERTION_LEVEL > 0
         /*
          * @brief Check whether @p first and @p last denote a valid range, i.e. @p first is less or equal than @p last.
@@ -528,7 +715,7 @@ namespace mpicxx {
          * @return `true` if @p maxprocs is legal, `false` otherwise
          */
         bool legal_maxprocs(const int maxprocs) const {
-            std::optional<int> universe_size = mpicxx::universe_size();
+            const std::optional<int>& universe_size = mpicxx::runtime_info().universe_size;
             if (universe_size.has_value()) {
                 return 0 < maxprocs && maxprocs <= universe_size.value();
             } else {
@@ -571,6 +758,7 @@ namespace mpicxx {
         info info_ = mpicxx::info::null;
         int root_ = 0;
         MPI_Comm comm_ = MPI_COMM_WORLD;
+        std::optional<spawn_payload_type> payload_;
     };
 
     /// The default spawner is a @ref single_spawner.
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements the handoff of (large) binary payloads from the spawning to the spawned processes without using the command line
+ *        arguments.
+ */
+
+#ifndef MPICXX_SPAWN_PAYLOAD_HPP
+#define MPICXX_SPAWN_PAYLOAD_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <fmt/format.h>
+#include <mpi.h>
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace mpicxx {
+
+    /// The type of a payload handed off to spawned processes.
+    using spawn_payload_type = std::vector<std::byte>;
+
+    namespace detail {
+
+        /// Message tag of a payload sent to a spawned process (the largest tag value guaranteed by the MPI standard).
+        inline constexpr int spawn_payload_tag = 32767;
+
+        /**
+         * @brief Checks whether a payload of @p size bytes can be sent as **one** message, i.e. @p size can be represented by an `int`.
+         * @param[in] size the size of the payload
+         *
+         * @throws std::length_error if @p size is greater than the maximum value representable by an `int`
+         */
+        inline void check_spawn_payload_size(const std::size_t size) {
+            if (size > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+                throw std::length_error(fmt::format("The payload size (which is {}) is greater than the maximum possible size (which is {})!",
+                        size, std::numeric_limits<int>::max()));
+            }
+        }
+
+        /**
+         * @brief Sends the payloads to the spawned processes over the newly created intercommunicator @p intercomm.
+         * @details Only the @p root process sends: every spawned process, whose executable has a payload set, receives it as
+         *          **one** message. If the spawning and the spawned processes share a host, the MPI library delivers the message through
+         *          its node-local shared memory transport. \n
+         *          The spawned processes are ranked in the order of the executables. If @p errcodes isn't `nullptr`, processes which
+         *          couldn't be spawned are skipped.
+         * @param[in] intercomm the intercommunicator returned by the spawn
+         * @param[in] root the root process in @p comm
+         * @param[in] comm the intracommunicator containing the group of spawning processes
+         * @param[in] payloads the payload of each executable (`nullptr` if no payload has been set)
+         * @param[in] maxprocs the number of processes of each executable
+         * @param[in] errcodes the error codes of the spawn or `nullptr`
+         *
+         * @throws std::length_error if the size of a payload is greater than the maximum value representable by an `int` (checked
+         *         before anything is sent)
+         *
+         * @calls{
+         * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                                   // exactly once
+         * int MPI_Comm_remote_size(MPI_Comm comm, int *size);                                            // at most once
+         * int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request);    // at most once per spawned process
+         * int MPI_Waitall(int count, MPI_Request array_of_requests[], MPI_Status *array_of_statuses);    // at most once
+         * }
+         */
+        inline void send_spawn_payloads(const MPI_Comm intercomm, const int root, const MPI_Comm comm,
+                                        const std::span<const spawn_payload_type* const> payloads,
+                                        const std::span<const int> maxprocs, const int* errcodes)
+        {
+            int rank;
+            MPI_Comm_rank(comm, &rank);
+            if (rank != root || intercomm == MPI_COMM_NULL) {
+                return;
+            }
+
+            for (const spawn_payload_type* payload : payloads) {
+                if (payload != nullptr) {
+                    check_spawn_payload_size(payload->size());
+                }
+            }
+
+            int remote_size;
+            MPI_Comm_remote_size(intercomm, &remote_size);
+
+            std::vector<MPI_Request> requests;
+            int child = 0;
+            std::size_t pos = 0;
+            for (std::size_t i = 0; i < payloads.size(); ++i) {
+                for (int j = 0; j < maxprocs[i]; ++j, ++pos) {
+                    if ((errcodes != nullptr && errcodes[pos] != MPI_SUCCESS) || child >= remote_size) {
+                        // the process hasn't been spawned
+                        continue;
+                    }
+                    if (payloads[i] != nullptr) {
+                        MPI_Request request;
+                        MPI_Isend(payloads[i]->data(), static_cast<int>(payloads[i]->size()), MPI_BYTE, child, spawn_payload_tag, intercomm, &request);
+                        requests.push_back(request);
+                    }
+                    ++child;
+                }
+            }
+
+            if (!requests.empty()) {
+                MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+            }
+        }
+        /**
+         * @brief Sends the payloads to the spawned processes over the newly created intercommunicator @p intercomm.
+         * @details See the above overload.
+         * @param[in] intercomm the intercommunicator returned by the spawn
+         * @param[in] root the root process in @p comm
+         * @param[in] comm the intracommunicator containing the group of spawning processes
+         * @param[in] payloads the (optional) payload of each executable
+         * @param[in] maxprocs the number of processes of each executable
+         * @param[in] errcodes the error codes of the spawn or `nullptr`
+         */
+        inline void send_spawn_payloads(const MPI_Comm intercomm, const int root, const MPI_Comm comm,
+                                        const std::span<const std::optional<spawn_payload_type>> payloads,
+                                        const std::span<const int> maxprocs, const int* errcodes)
+        {
+            std::vector<const spawn_payload_type*> ptr;
+            ptr.reserve(payloads.size());
+            for (const std::optional<spawn_payload_type>& payload : payloads) {
+                ptr.push_back(payload.has_value() ? &payload.value() : nullptr);
+            }
+            send_spawn_payloads(intercomm, root, comm, ptr, maxprocs, errcodes);
+        }
+
+    }
+
+    /**
+     * @brief Receives the payload handed off by the parent processes via @ref mpicxx::single_spawner::set_payload(std::span<const std::byte>)
+     *        respectively @ref mpicxx::multiple_spawner::set_payload_at(const std::size_t, std::span<const std::byte>).
+     * @details Must be called **exactly once** by every spawned process whose executable has a payload set. The spawn invocation of the
+     *          parent processes doesn't return before all spawned processes received their payload.
+     * @return the payload
+     * @nodiscard
+     *
+     * @pre The current process **must** have been spawned (see @ref mpicxx::parent_process()).
+     *
+     * @assert_precondition{ If the current process hasn't been spawned. }
+     *
+     * @calls{
+     * int MPI_Comm_get_parent(MPI_Comm *parent);                                         // exactly once
+     * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);             // exactly once
+     * int MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count);    // exactly once
+     * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
+     */
+    [[nodiscard]]
+    inline spawn_payload_type receive_payload() {
+        mpicxx::ensure_initialized();
+
+        MPI_Comm parent;
+        MPI_Comm_get_parent(&parent);
+        MPICXX_ASSERT_PRECONDITION(parent != MPI_COMM_NULL, "Attempt to receive a payload without a parent process!");
+
+        MPI_Status status;
+        MPI_Probe(MPI_ANY_SOURCE, detail::spawn_payload_tag, parent, &status);
+        int count;
+        MPI_Get_count(&status, MPI_BYTE, &count);
+
+        spawn_payload_type payload(static_cast<std::size_t>(count));
+        MPI_Recv(payload.data(), count, MPI_BYTE, status.MPI_SOURCE, detail::spawn_payload_tag, parent, MPI_STATUS_IGNORE);
+        return payload;
+    }
+
+}
+
+#endif // MPICXX_SPAWN_PAYLOAD_HPP
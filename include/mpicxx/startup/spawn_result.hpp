@@ -12,24 +12,30 @@
 #ifndef MPICXX_SPAWNER_RESULT_HPP
 #define MPICXX_SPAWNER_RESULT_HPP
 
+#include <mpicxx/chrono/clock.hpp>
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/errcode.hpp>
+#include <mpicxx/startup/merged_communicator.hpp>
+#include <mpicxx/startup/spawn_timings.hpp>
+
 #include <fmt/format.h>
 #include <mpi.h>
 
 #include <algorithm>
-#include <map>
+#include <iterator>
 #include <optional>
+#include <stdexcept>
 #include <string>
-#include <string_view>
 #include <vector>
 
 namespace mpicxx {
 
     // TODO 2020-04-14 21:55 breyerml: change from MPI_Comm to mpicxx equivalent
-    // TODO 2020-04-14 21:55 breyerml: change from int to mpicxx errcode equivalent
 
     // forward declare all spawner classes
     class single_spawner;
     class multiple_spawner;
+    class prepared_spawn;
 
 
     /**
@@ -43,6 +49,8 @@ namespace mpicxx {
         friend class mpicxx::single_spawner;
         // befriend mpicxx::multiple_spawner
         friend class mpicxx::multiple_spawner;
+        // befriend mpicxx::prepared_spawn
+        friend class mpicxx::prepared_spawn;
 
 
         // ---------------------------------------------------------------------------------------------------------- //
@@ -104,10 +112,63 @@ namespace mpicxx {
         MPI_Comm intercommunicator() const noexcept {
             return intercomm_;
         }
+        /**
+         * @brief Returns the timing breakdown of the spawn invocation (see @ref mpicxx::spawn_timings).
+         * @details The handshake timestamp is only set after a call to @ref handshake().
+         * @return the spawn timings
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const spawn_timings& timings() const noexcept {
+            return timings_;
+        }
+        /**
+         * @brief Waits until all spawned processes have called @ref mpicxx::parent_handshake() and records the respective timestamp.
+         * @details Since the spawned processes can only call @ref mpicxx::parent_handshake() after their MPI environment has been
+         *          initialized, the handshake duration contains their [*MPI_Init*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)
+         *          time. \n
+         *          Must be called by **all** processes of the spawning communicator.
+         *
+         * @pre The spawn must have succeeded, i.e. the intercommunicator **must not** be
+         *      [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the intercommunicator is [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @calls{
+         * int MPI_Barrier(MPI_Comm comm);    // exactly once
+         * double MPI_Wtime();               // exactly once
+         * }
+         */
+        void handshake() {
+            MPICXX_ASSERT_PRECONDITION(intercomm_ != MPI_COMM_NULL, "Attempt to perform a handshake with a failed spawn!");
+
+            MPI_Barrier(intercomm_);
+            timings_.handshake_end = clock::now();
+        }
+        /**
+         * @brief Merges the spawning and the spawned processes into one intracommunicator.
+         * @details Must be called by **all** processes of the spawning communicator while the spawned processes call
+         *          @ref mpicxx::merge_with_parent(). Afterwards the optimized intracommunicator collectives can be used directly.
+         * @param[in] high `false` (default) to order the spawning processes before the spawned processes, `true` to order them last
+         * @return the owning merged intracommunicator
+         * @nodiscard
+         *
+         * @pre The spawn must have succeeded, i.e. the intercommunicator **must not** be
+         *      [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the intercommunicator is [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @calls{ int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);    // exactly once }
+         */
+        [[nodiscard]]
+        merged_communicator merge(const bool high = false) const {
+            return merged_communicator(intercomm_, high);
+        }
         /**
          * @brief Returns the errcodes (one for each process) returned by the
          *        [*MPI_Comm_spawn*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node237.htm) respectively
          *        [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) call.
+         * @details The raw MPI error codes are returned such that they can be passed to other MPI functions directly.
          * @return the errcodes
          * @nodiscard
          */
@@ -115,45 +176,69 @@ namespace mpicxx {
         const std::vector<int>& errcodes() const noexcept {
             return errcodes_;
         }
+        /**
+         * @brief Returns the errcode of the @p i-th process.
+         * @param[in] i the index of the process
+         * @return the errcode
+         * @nodiscard
+         *
+         * @pre @p i **must not** be greater or equal than `this->errcodes().size()`.
+         *
+         * @throws std::out_of_range if the index @p i falls outside the valid range
+         */
+        [[nodiscard]]
+        errcode errcode_at(const std::size_t i) const {
+            if (i >= errcodes_.size()) {
+                throw std::out_of_range(fmt::format(
+                        "spawn_result_with_errcodes::errcode_at(const std::size_t) range check: i (which is {}) >= errcodes_.size() (which is {})",
+                        i, errcodes_.size()));
+            }
+
+            return errcode(errcodes_[i]);
+        }
+        /**
+         * @brief Returns the structured summary of all failed spawns, i.e. for each distinct errcode how often and where it occurred
+         *        first (see @ref mpicxx::summarize_errcodes()).
+         * @return the summary of each distinct errcode (empty if all processes could be spawned)
+         * @nodiscard
+         *
+         * @calls{ int MPI_Error_string(int errorcode, char *string, int *resultlen);    // exactly once per distinct errcode }
+         */
+        [[nodiscard]]
+        std::vector<errcode_summary> error_summary() const {
+            return summarize_errcodes(errcodes_);
+        }
         /**
          * @brief Returns the number of failed spawns and the respective errcode messages (including how often an errcode occurred).
+         * @details The errcodes are listed in ascending order.
          * @return the errcode messages
          * @nodiscard
          *
-         * @calls{ int MPI_Error_string(int errorcode, char *string, int *resultlen);    // at most 'maxprocs' times }
+         * @calls{ int MPI_Error_string(int errorcode, char *string, int *resultlen);    // exactly once per distinct errcode }
          */
         [[nodiscard]]
         std::string error_list() const {
-            // count the number of errors
-            const auto failed_spawns = std::count_if(errcodes_.cbegin(), errcodes_.cend(),
-                    [](const int err) { return err != MPI_SUCCESS; });
+            std::vector<errcode_summary> summary = this->error_summary();
 
             // no errors occurred
-            if (failed_spawns == 0) {
+            if (summary.empty()) {
                 return "0 errors occurred!";
             }
 
-            fmt::memory_buffer buf;
-            fmt::format_to(buf, "{} {} occurred!:\n", failed_spawns, failed_spawns == 1 ? "error" : "errors");
-
-            // count how often each error occurred
-            std::map<int, int> counts;
-            for (const int err : errcodes_) {
-                if (err != MPI_SUCCESS) {
-                    ++counts[err];
-                }
+            // count the number of errors
+            std::size_t failed_spawns = 0;
+            for (const errcode_summary& entry : summary) {
+                failed_spawns += entry.count;
             }
 
-            // retrieve the error string and print it
-            for (const auto [err, count] : counts) {
-                if (err == -1) {
-                    fmt::format_to(buf, "{:>5}x Failed to retrieve error string\n", count);
-                } else {
-                    char error_string[MPI_MAX_ERROR_STRING];
-                    int resultlen;
-                    MPI_Error_string(err, error_string, &resultlen);
-                    fmt::format_to(buf, "{:>5}x {}\n", count, std::string_view(error_string, resultlen));
-                }
+            fmt::memory_buffer buf;
+            fmt::format_to(std::back_inserter(buf), "{} {} occurred!:\n", failed_spawns, failed_spawns == 1 ? "error" : "errors");
+
+            // print the cached error strings
+            std::sort(summary.begin(), summary.end(),
+                    [](const errcode_summary& lhs, const errcode_summary& rhs) { return lhs.code < rhs.code; });
+            for (const errcode_summary& entry : summary) {
+                fmt::format_to(std::back_inserter(buf), "{:>5}x {}\n", entry.count, entry.message);
             }
 
             using std::to_string;
@@ -163,6 +248,7 @@ namespace mpicxx {
     private:
         std::vector<int> errcodes_;
         MPI_Comm intercomm_ = MPI_COMM_NULL;
+        spawn_timings timings_;
     };
 
 
@@ -177,6 +263,8 @@ namespace mpicxx {
         friend class mpicxx::single_spawner;
         // befriend mpicxx::multiple_spawner
         friend class mpicxx::multiple_spawner;
+        // befriend mpicxx::prepared_spawn
+        friend class mpicxx::prepared_spawn;
 
 
         // ---------------------------------------------------------------------------------------------------------- //
@@ -238,10 +326,63 @@ namespace mpicxx {
         MPI_Comm intercommunicator() const noexcept {
             return intercomm_;
         }
+        /**
+         * @brief Returns the timing breakdown of the spawn invocation (see @ref mpicxx::spawn_timings).
+         * @details The handshake timestamp is only set after a call to @ref handshake().
+         * @return the spawn timings
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const spawn_timings& timings() const noexcept {
+            return timings_;
+        }
+        /**
+         * @brief Waits until all spawned processes have called @ref mpicxx::parent_handshake() and records the respective timestamp.
+         * @details Since the spawned processes can only call @ref mpicxx::parent_handshake() after their MPI environment has been
+         *          initialized, the handshake duration contains their [*MPI_Init*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)
+         *          time. \n
+         *          Must be called by **all** processes of the spawning communicator.
+         *
+         * @pre The spawn must have succeeded, i.e. the intercommunicator **must not** be
+         *      [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the intercommunicator is [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @calls{
+         * int MPI_Barrier(MPI_Comm comm);    // exactly once
+         * double MPI_Wtime();               // exactly once
+         * }
+         */
+        void handshake() {
+            MPICXX_ASSERT_PRECONDITION(intercomm_ != MPI_COMM_NULL, "Attempt to perform a handshake with a failed spawn!");
+
+            MPI_Barrier(intercomm_);
+            timings_.handshake_end = clock::now();
+        }
+        /**
+         * @brief Merges the spawning and the spawned processes into one intracommunicator.
+         * @details Must be called by **all** processes of the spawning communicator while the spawned processes call
+         *          @ref mpicxx::merge_with_parent(). Afterwards the optimized intracommunicator collectives can be used directly.
+         * @param[in] high `false` (default) to order the spawning processes before the spawned processes, `true` to order them last
+         * @return the owning merged intracommunicator
+         * @nodiscard
+         *
+         * @pre The spawn must have succeeded, i.e. the intercommunicator **must not** be
+         *      [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the intercommunicator is [*MPI_COMM_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @calls{ int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);    // exactly once }
+         */
+        [[nodiscard]]
+        merged_communicator merge(const bool high = false) const {
+            return merged_communicator(intercomm_, high);
+        }
         
     private:
         int maxprocs_;
         MPI_Comm intercomm_ = MPI_COMM_NULL;
+        spawn_timings timings_;
     };
 
 
@@ -252,9 +393,16 @@ namespace mpicxx {
      * @return a [`std::optional`](https://en.cppreference.com/w/cpp/utility/optional) containing the parent intercommunicator or
      *         [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt)
      * @nodiscard
+     *
+     * @calls{
+     * int MPI_Comm_get_parent(MPI_Comm *parent);    // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
      */
     [[nodiscard]]
     inline std::optional<MPI_Comm> parent_process() {
+        mpicxx::ensure_initialized();
+
         MPI_Comm intercomm;
         MPI_Comm_get_parent(&intercomm);
         if (intercomm != MPI_COMM_NULL) {
@@ -264,6 +412,61 @@ namespace mpicxx {
         }
     }
 
+    /**
+     * @brief Merges the spawned processes with their parent processes into one intracommunicator (the spawned side of
+     *        @ref mpicxx::spawn_result::merge() respectively @ref mpicxx::spawn_result_with_errcodes::merge()).
+     * @details Must be called by **all** spawned processes.
+     * @param[in] high `true` (default) to order the spawned processes after the parent processes, `false` to order them first
+     * @return the owning merged intracommunicator
+     * @nodiscard
+     *
+     * @pre The current process **must** have been spawned (see @ref mpicxx::parent_process()).
+     *
+     * @assert_precondition{ If the current process hasn't been spawned. }
+     *
+     * @calls{
+     * int MPI_Comm_get_parent(MPI_Comm *parent);                                        // exactly once
+     * int MPI_Intercomm_merge(MPI_Comm intercomm, int high, MPI_Comm *newintracomm);    // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
+     */
+    [[nodiscard]]
+    inline merged_communicator merge_with_parent(const bool high = true) {
+        mpicxx::ensure_initialized();
+
+        MPI_Comm intercomm;
+        MPI_Comm_get_parent(&intercomm);
+        MPICXX_ASSERT_PRECONDITION(intercomm != MPI_COMM_NULL, "Attempt to merge with the parent processes without a parent process!");
+
+        return merged_communicator(intercomm, high);
+    }
+
+    /**
+     * @brief Performs the handshake with the parent processes (see @ref mpicxx::spawn_result::handshake() respectively
+     *        @ref mpicxx::spawn_result_with_errcodes::handshake()).
+     * @details Must be called by **all** spawned processes if the parent processes perform a handshake. Calling it directly after
+     *          @ref mpicxx::init() allows the parent processes to measure the initialization time of the spawned processes.
+     *
+     * @pre The current process **must** have been spawned (see @ref mpicxx::parent_process()).
+     *
+     * @assert_precondition{ If the current process hasn't been spawned. }
+     *
+     * @calls{
+     * int MPI_Comm_get_parent(MPI_Comm *parent);    // exactly once
+     * int MPI_Barrier(MPI_Comm comm);               // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
+     */
+    inline void parent_handshake() {
+        mpicxx::ensure_initialized();
+
+        MPI_Comm intercomm;
+        MPI_Comm_get_parent(&intercomm);
+        MPICXX_ASSERT_PRECONDITION(intercomm != MPI_COMM_NULL, "Attempt to perform a handshake without a parent process!");
+
+        MPI_Barrier(intercomm);
+    }
+
 }
 
 #endif // MPICXX_SPAWNER_RESULT_HPP
\ No newline at end of file
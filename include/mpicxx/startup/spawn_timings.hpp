@@ -0,0 +1,259 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements the timing breakdown of a single spawn invocation and the aggregation of multiple of them.
+ */
+
+#ifndef MPICXX_SPAWN_TIMINGS_HPP
+#define MPICXX_SPAWN_TIMINGS_HPP
+
+#include <mpicxx/chrono/clock.hpp>
+#include <mpicxx/detail/assert.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace mpicxx {
+
+    /**
+     * @brief Enum class for the different phases of a spawn invocation.
+     */
+    enum class spawn_phase {
+        /** converting the spawn options to the format expected by the MPI functions */
+        marshalling,
+        /** the [*MPI_Comm_spawn*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node237.htm) or
+         * [*MPI_Comm_spawn_multiple*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node238.htm) call itself */
+        spawn,
+        /** the optional handshake with the spawned processes (i.e. the time until they have finished their initialization) */
+        handshake,
+        /** the whole spawn invocation (including the handshake if performed) */
+        total
+    };
+
+    /// @name mpicxx::spawn_phase conversion functions
+    ///@{
+    /**
+     * @brief Stream-insertion operator overload for the @ref mpicxx::spawn_phase enum class.
+     * @param[inout] out an output stream
+     * @param[in] phase the enum class value
+     * @return the output stream
+     */
+    inline std::ostream& operator<<(std::ostream& out, const spawn_phase phase) {
+        switch (phase) {
+            case spawn_phase::marshalling:
+                out << "marshalling";
+                break;
+            case spawn_phase::spawn:
+                out << "spawn";
+                break;
+            case spawn_phase::handshake:
+                out << "handshake";
+                break;
+            case spawn_phase::total:
+                out << "total";
+                break;
+        }
+        return out;
+    }
+    ///@}
+
+
+    /**
+     * @brief The timestamps (measured with @ref mpicxx::clock) of a single spawn invocation.
+     * @details Exposed as durations of the different @ref mpicxx::spawn_phase.
+     */
+    struct spawn_timings {
+        /// The point in time the conversion of the spawn options started.
+        clock::time_point marshalling_begin{};
+        /// The point in time the conversion of the spawn options ended, i.e. the MPI spawn function got called.
+        clock::time_point marshalling_end{};
+        /// The point in time the MPI spawn function returned.
+        clock::time_point spawn_end{};
+        /// The point in time the optional handshake with the spawned processes completed.
+        std::optional<clock::time_point> handshake_end{};
+
+        /**
+         * @brief Returns the duration of the phase @p phase.
+         * @param[in] phase the spawn phase
+         * @return the duration (`0` for @ref mpicxx::spawn_phase::handshake if no handshake has been performed)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        clock::duration duration(const spawn_phase phase) const noexcept {
+            switch (phase) {
+                case spawn_phase::marshalling:
+                    return marshalling_end - marshalling_begin;
+                case spawn_phase::spawn:
+                    return spawn_end - marshalling_end;
+                case spawn_phase::handshake:
+                    return handshake_end.has_value() ? handshake_end.value() - spawn_end : clock::duration::zero();
+                case spawn_phase::total:
+                    return handshake_end.value_or(spawn_end) - marshalling_begin;
+            }
+            return clock::duration::zero();
+        }
+        /**
+         * @brief Returns the duration of the conversion of the spawn options.
+         * @return the duration
+         * @nodiscard
+         */
+        [[nodiscard]]
+        clock::duration marshalling() const noexcept { return this->duration(spawn_phase::marshalling); }
+        /**
+         * @brief Returns the duration of the MPI spawn function call.
+         * @return the duration
+         * @nodiscard
+         */
+        [[nodiscard]]
+        clock::duration spawn() const noexcept { return this->duration(spawn_phase::spawn); }
+        /**
+         * @brief Returns the duration of the handshake with the spawned processes.
+         * @return the duration or [`std::nullopt`](https://en.cppreference.com/w/cpp/utility/optional/nullopt) if no handshake has been
+         *         performed
+         * @nodiscard
+         */
+        [[nodiscard]]
+        std::optional<clock::duration> handshake() const noexcept {
+            if (handshake_end.has_value()) {
+                return std::make_optional(this->duration(spawn_phase::handshake));
+            } else {
+                return std::nullopt;
+            }
+        }
+        /**
+         * @brief Returns the duration of the whole spawn invocation (including the handshake if performed).
+         * @return the duration
+         * @nodiscard
+         */
+        [[nodiscard]]
+        clock::duration total() const noexcept { return this->duration(spawn_phase::total); }
+    };
+
+
+    /**
+     * @brief Aggregates the @ref mpicxx::spawn_timings of multiple spawn invocations, e.g. to track spawn latency percentiles.
+     * @details The handshake phase only aggregates spawn invocations for which a handshake has been performed.
+     */
+    class spawn_statistics {
+    public:
+        /// Unsigned integer type.
+        using size_type = std::size_t;
+
+        /**
+         * @brief Adds the timings of one spawn invocation.
+         * @param[in] timings the spawn timings
+         */
+        void add(const spawn_timings& timings) {
+            durations_[index(spawn_phase::marshalling)].push_back(timings.marshalling());
+            durations_[index(spawn_phase::spawn)].push_back(timings.spawn());
+            if (const auto handshake = timings.handshake(); handshake.has_value()) {
+                durations_[index(spawn_phase::handshake)].push_back(handshake.value());
+            }
+            durations_[index(spawn_phase::total)].push_back(timings.total());
+        }
+        /**
+         * @brief Adds all timings aggregated in @p other.
+         * @param[in] other the other statistics
+         */
+        void merge(const spawn_statistics& other) {
+            for (size_type i = 0; i < durations_.size(); ++i) {
+                durations_[i].insert(durations_[i].end(), other.durations_[i].cbegin(), other.durations_[i].cend());
+            }
+        }
+        /**
+         * @brief Removes all aggregated timings.
+         */
+        void clear() noexcept {
+            for (std::vector<clock::duration>& vec : durations_) {
+                vec.clear();
+            }
+        }
+
+        /**
+         * @brief Returns the number of aggregated timings for the phase @p phase.
+         * @param[in] phase the spawn phase
+         * @return the number of aggregated timings
+         * @nodiscard
+         */
+        [[nodiscard]]
+        size_type count(const spawn_phase phase = spawn_phase::total) const noexcept { return durations_[index(phase)].size(); }
+        /**
+         * @brief Returns the mean duration of the phase @p phase.
+         * @param[in] phase the spawn phase
+         * @return the mean duration
+         * @nodiscard
+         *
+         * @pre At least one timing **must** have been aggregated for @p phase.
+         *
+         * @assert_precondition{ If no timing has been aggregated for @p phase. }
+         */
+        [[nodiscard]]
+        clock::duration mean(const spawn_phase phase = spawn_phase::total) const {
+            MPICXX_ASSERT_PRECONDITION(this->count(phase) > 0, "No timings aggregated for the spawn phase '{}'!", phase);
+
+            const std::vector<clock::duration>& vec = durations_[index(phase)];
+            clock::duration sum = clock::duration::zero();
+            for (const clock::duration d : vec) {
+                sum += d;
+            }
+            return sum / static_cast<clock::rep>(vec.size());
+        }
+        /**
+         * @brief Returns the @p p-th percentile (nearest-rank method) of the durations of the phase @p phase.
+         * @details `percentile(phase, 0.0)` is the minimum, `percentile(phase, 100.0)` the maximum duration.
+         * @param[in] phase the spawn phase
+         * @param[in] p the percentile
+         * @return the percentile
+         * @nodiscard
+         *
+         * @pre At least one timing **must** have been aggregated for @p phase.
+         * @pre @p p **must** be in the range `[0.0, 100.0]`.
+         *
+         * @assert_precondition{ If no timing has been aggregated for @p phase. \n
+         *                       If @p p falls outside the valid range. }
+         */
+        [[nodiscard]]
+        clock::duration percentile(const spawn_phase phase, const double p) const {
+            MPICXX_ASSERT_PRECONDITION(this->count(phase) > 0, "No timings aggregated for the spawn phase '{}'!", phase);
+            MPICXX_ASSERT_PRECONDITION(p >= 0.0 && p <= 100.0, "Requested percentile {} falls outside the valid range [0.0, 100.0]!", p);
+
+            std::vector<clock::duration> vec = durations_[index(phase)];
+            const auto rank = static_cast<size_type>(std::ceil(p / 100.0 * static_cast<double>(vec.size())));
+            const size_type idx = rank == 0 ? 0 : rank - 1;
+            std::nth_element(vec.begin(), vec.begin() + static_cast<std::ptrdiff_t>(idx), vec.end());
+            return vec[idx];
+        }
+        /**
+         * @brief Returns all aggregated durations of the phase @p phase (in the order they have been added).
+         * @param[in] phase the spawn phase
+         * @return the durations
+         * @nodiscard
+         */
+        [[nodiscard]]
+        const std::vector<clock::duration>& durations(const spawn_phase phase) const noexcept { return durations_[index(phase)]; }
+
+    private:
+        /*
+         * @brief Converts @p phase to an index into durations_.
+         * @param[in] phase the spawn phase
+         * @return the index
+         */
+        static constexpr size_type index(const spawn_phase phase) noexcept { return static_cast<size_type>(phase); }
+
+        std::array<std::vector<clock::duration>, 4> durations_;
+    };
+
+}
+
+#endif // MPICXX_SPAWN_TIMINGS_HPP
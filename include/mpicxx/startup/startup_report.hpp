@@ -0,0 +1,313 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements the opt-in profiling of the initialization, the user defined main function and the finalization performed by
+ *        @ref mpicxx::main().
+ */
+
+#ifndef MPICXX_STARTUP_REPORT_HPP
+#define MPICXX_STARTUP_REPORT_HPP
+
+#include <mpicxx/chrono/clock.hpp>
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/finalize.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <fmt/format.h>
+#include <mpi.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace mpicxx {
+
+    /**
+     * @brief Enum class for the different phases of @ref mpicxx::main().
+     */
+    enum class startup_phase {
+        /** the initialization of the MPI environment (e.g. [*MPI_Init_thread*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node303.htm)) */
+        init,
+        /** the user defined main function */
+        main,
+        /** the finalization of the MPI environment ([*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm)) */
+        finalize
+    };
+
+    /// @name mpicxx::startup_phase conversion functions
+    ///@{
+    /**
+     * @brief Stream-insertion operator overload for the @ref mpicxx::startup_phase enum class.
+     * @param[inout] out an output stream
+     * @param[in] phase the enum class value
+     * @return the output stream
+     */
+    inline std::ostream& operator<<(std::ostream& out, const startup_phase phase) {
+        switch (phase) {
+            case startup_phase::init:
+                out << "init";
+                break;
+            case startup_phase::main:
+                out << "main";
+                break;
+            case startup_phase::finalize:
+                out << "finalize";
+                break;
+        }
+        return out;
+    }
+    ///@}
+
+
+    /**
+     * @brief Enum class for the different output formats of a @ref mpicxx::startup_report.
+     */
+    enum class startup_report_format {
+        /** a human readable one-line summary */
+        line,
+        /** a single JSON object */
+        json
+    };
+
+
+    /**
+     * @brief The durations of one @ref mpicxx::startup_phase reduced across all ranks of
+     *        [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+     */
+    struct startup_phase_statistics {
+        /// The shortest duration of any rank.
+        clock::duration min{};
+        /// The longest duration of any rank.
+        clock::duration max{};
+        /// The mean duration over all ranks.
+        clock::duration mean{};
+    };
+
+    /**
+     * @brief The profiling report of one @ref mpicxx::main() invocation (created on rank `0` only).
+     * @details Since no communication is possible after [*MPI_Finalize*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm),
+     *          the durations of @ref mpicxx::startup_phase::init and @ref mpicxx::startup_phase::main are reduced across all ranks
+     *          **before** finalizing, while the duration of @ref mpicxx::startup_phase::finalize is the one measured on rank `0`.
+     */
+    struct startup_report {
+        /// The number of ranks in [*MPI_COMM_WORLD*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+        int number_of_ranks = 0;
+        /// The reduced durations of the initialization of the MPI environment.
+        startup_phase_statistics init;
+        /// The reduced durations of the user defined main function.
+        startup_phase_statistics main;
+        /// The duration of the finalization of the MPI environment on rank `0`.
+        clock::duration finalize{};
+
+        /**
+         * @brief Converts the report to a string in the format @p format.
+         * @details All durations are printed in seconds.
+         * @param[in] format the output format
+         * @return the formatted report
+         * @nodiscard
+         */
+        [[nodiscard]]
+        std::string to_string(const startup_report_format format = startup_report_format::line) const {
+            switch (format) {
+                case startup_report_format::line:
+                    return fmt::format("mpicxx startup report ({} ranks): "
+                                       "init min={:.6f}s max={:.6f}s mean={:.6f}s | "
+                                       "main min={:.6f}s max={:.6f}s mean={:.6f}s | "
+                                       "finalize {:.6f}s (rank 0)",
+                                       number_of_ranks,
+                                       init.min.count(), init.max.count(), init.mean.count(),
+                                       main.min.count(), main.max.count(), main.mean.count(),
+                                       finalize.count());
+                case startup_report_format::json:
+                    return fmt::format("{{\"ranks\":{},"
+                                       "\"init\":{{\"min\":{:.6f},\"max\":{:.6f},\"mean\":{:.6f}}},"
+                                       "\"main\":{{\"min\":{:.6f},\"max\":{:.6f},\"mean\":{:.6f}}},"
+                                       "\"finalize\":{:.6f}}}",
+                                       number_of_ranks,
+                                       init.min.count(), init.max.count(), init.mean.count(),
+                                       main.min.count(), main.max.count(), main.mean.count(),
+                                       finalize.count());
+            }
+            return std::string{};
+        }
+    };
+
+
+    namespace detail {
+
+        /// `true` if @ref mpicxx::main() should create a @ref mpicxx::startup_report.
+        inline bool startup_profiling_enabled = false;
+        /// The sink the formatted @ref mpicxx::startup_report gets written to (on rank `0` only).
+        inline std::function<void(std::string_view)> startup_profiling_sink;
+        /// The output format of the @ref mpicxx::startup_report.
+        inline startup_report_format startup_profiling_format = startup_report_format::line;
+
+    }
+
+
+    /**
+     * @brief Opt-in profiling of @ref mpicxx::main().
+     * @details If enabled, @ref mpicxx::main() measures the durations of all @ref mpicxx::startup_phase, reduces them across all ranks
+     *          and writes the resulting @ref mpicxx::startup_report to the configured sink on rank `0` (after finalizing the MPI
+     *          environment). \n
+     *          Since [*MPI_Wtime*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node224.htm) can't be called outside of an
+     *          initialized MPI environment, the durations are measured with
+     *          [`std::chrono::steady_clock`](https://en.cppreference.com/w/cpp/chrono/steady_clock) and converted to
+     *          @ref mpicxx::clock::duration. \n
+     *          The profiling is disabled by default and **must** be configured before calling @ref mpicxx::main().
+     *
+     *    Example: @snippet examples/startup/mpicxx_main.cpp mpicxx_main version with startup report
+     */
+    class startup_profiling {
+    public:
+        /// The type of the sink the formatted @ref mpicxx::startup_report gets written to.
+        using sink_type = std::function<void(std::string_view)>;
+
+        /**
+         * @brief Enables the profiling, writing the formatted @ref mpicxx::startup_report to @p sink.
+         * @param[in] sink the sink
+         * @param[in] format the output format
+         *
+         * @pre @p sink **must not** be empty.
+         *
+         * @assert_precondition{ If @p sink is empty. }
+         */
+        static void enable(sink_type sink, const startup_report_format format = startup_report_format::line) {
+            MPICXX_ASSERT_PRECONDITION(static_cast<bool>(sink), "The startup report sink cannot be empty!");
+
+            detail::startup_profiling_sink = std::move(sink);
+            detail::startup_profiling_format = format;
+            detail::startup_profiling_enabled = true;
+        }
+        /**
+         * @brief Enables the profiling, writing the formatted @ref mpicxx::startup_report as one line to @p out.
+         * @param[inout] out the output stream (**must** outlive the call to @ref mpicxx::main())
+         * @param[in] format the output format
+         */
+        static void enable(std::ostream& out = std::clog, const startup_report_format format = startup_report_format::line) {
+            startup_profiling::enable([&out](const std::string_view report) { out << report << std::endl; }, format);
+        }
+        /**
+         * @brief Disables the profiling.
+         */
+        static void disable() noexcept {
+            detail::startup_profiling_enabled = false;
+        }
+        /**
+         * @brief Returns whether the profiling is enabled.
+         * @return `true` if the profiling is enabled, `false` otherwise
+         * @nodiscard
+         */
+        [[nodiscard]]
+        static bool enabled() noexcept { return detail::startup_profiling_enabled; }
+    };
+
+
+    namespace detail {
+
+        /**
+         * @brief Measures the @ref mpicxx::startup_phase of one @ref mpicxx::main() invocation (only if
+         *        @ref mpicxx::startup_profiling is enabled).
+         */
+        class startup_profiler {
+        public:
+            /**
+             * @brief Starts measuring the phase @p phase (and stops measuring the currently running phase if any).
+             * @param[in] phase the phase to start
+             */
+            void start(const startup_phase phase) {
+                if (enabled_) {
+                    const auto now = std::chrono::steady_clock::now();
+                    this->stop(now);
+                    running_ = std::make_pair(phase, now);
+                }
+            }
+            /**
+             * @brief Finalizes the MPI environment and writes the @ref mpicxx::startup_report to the configured sink on rank `0`.
+             * @details Stops measuring the currently running phase, reduces the durations across all ranks, measures
+             *          @ref mpicxx::finalize() and writes the report. Does nothing if the MPI environment has never been initialized
+             *          (lazy initialization, see @ref mpicxx::enable_lazy_init()).
+             *
+             * @calls{
+             * int MPI_Initialized(int *flag);                                                                                               // exactly once
+             * int MPI_Comm_rank(MPI_Comm comm, int *rank);                                                                                  // at most once
+             * int MPI_Comm_size(MPI_Comm comm, int *size);                                                                                  // at most once
+             * int MPI_Reduce(const void *sendbuf, void *recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root, MPI_Comm comm);    // at most three times
+             * int MPI_Finalize();                                                                                                           // at most once
+             * }
+             */
+            void finalize() {
+                // the deferred initialization (see mpicxx::defer_init()) has never been performed -> nothing to finalize or report
+                if (!mpicxx::initialized()) {
+                    return;
+                }
+                if (!enabled_) {
+                    mpicxx::finalize();
+                    return;
+                }
+
+                this->stop(std::chrono::steady_clock::now());
+
+                // reduce the durations before finalizing (no communication is possible afterwards)
+                startup_report report;
+                int rank;
+                MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+                MPI_Comm_size(MPI_COMM_WORLD, &report.number_of_ranks);
+                const std::array<double, 2> local = { durations_[index(startup_phase::init)].count(),
+                                                      durations_[index(startup_phase::main)].count() };
+                std::array<double, 2> min{}, max{}, sum{};
+                MPI_Reduce(local.data(), min.data(), 2, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+                MPI_Reduce(local.data(), max.data(), 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+                MPI_Reduce(local.data(), sum.data(), 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+                this->start(startup_phase::finalize);
+                mpicxx::finalize();
+                this->stop(std::chrono::steady_clock::now());
+
+                if (rank == 0) {
+                    const double ranks = static_cast<double>(report.number_of_ranks);
+                    report.init = startup_phase_statistics{ clock::duration(min[0]), clock::duration(max[0]), clock::duration(sum[0] / ranks) };
+                    report.main = startup_phase_statistics{ clock::duration(min[1]), clock::duration(max[1]), clock::duration(sum[1] / ranks) };
+                    report.finalize = durations_[index(startup_phase::finalize)];
+                    startup_profiling_sink(report.to_string(startup_profiling_format));
+                }
+            }
+
+        private:
+            /*
+             * @brief Stops measuring the currently running phase (if any) at @p now.
+             * @param[in] now the current point in time
+             */
+            void stop(const std::chrono::steady_clock::time_point now) {
+                if (running_.has_value()) {
+                    durations_[index(running_->first)] = std::chrono::duration_cast<clock::duration>(now - running_->second);
+                    running_.reset();
+                }
+            }
+            /*
+             * @brief Converts @p phase to an index into durations_.
+             * @param[in] phase the startup phase
+             * @return the index
+             */
+            static constexpr std::size_t index(const startup_phase phase) noexcept { return static_cast<std::size_t>(phase); }
+
+            const bool enabled_ = startup_profiling_enabled;
+            std::optional<std::pair<startup_phase, std::chrono::steady_clock::time_point>> running_;
+            std::array<clock::duration, 3> durations_{};
+        };
+
+    }
+
+}
+
+#endif // MPICXX_STARTUP_REPORT_HPP
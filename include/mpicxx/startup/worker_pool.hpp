@@ -0,0 +1,609 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Implements a pool of warm worker processes spawned once via a @ref mpicxx::multiple_spawner and reused for multiple tasks.
+ */
+
+#ifndef MPICXX_WORKER_POOL_HPP
+#define MPICXX_WORKER_POOL_HPP
+
+#include <mpicxx/detail/assert.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/multiple_spawner.hpp>
+#include <mpicxx/startup/spawn_result.hpp>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mpicxx {
+
+    /**
+     * @brief The result of a task processed by a worker of a @ref mpicxx::worker_pool.
+     */
+    struct worker_task_result {
+        /// The ticket returned by @ref mpicxx::worker_pool::submit().
+        std::uint64_t ticket;
+        /// `true` if the task handler returned normally, `false` if it threw an exception.
+        bool succeeded;
+        /// The serialized result of the task handler or the exception message if the task handler failed.
+        std::vector<std::byte> payload;
+    };
+
+
+    namespace detail {
+
+        /// Message tag of a task sent from the @ref mpicxx::worker_pool to a worker (an **empty** message tells the worker to leave
+        /// @ref mpicxx::worker_loop()).
+        inline constexpr int worker_pool_task_tag = 1;
+        /// Message tag of a successful task result sent from a worker to the @ref mpicxx::worker_pool.
+        inline constexpr int worker_pool_result_tag = 2;
+        /// Message tag of a failed task result sent from a worker to the @ref mpicxx::worker_pool.
+        inline constexpr int worker_pool_failure_tag = 3;
+        /// The size of the header of a task message: `[ticket][function id]`.
+        inline constexpr std::size_t worker_pool_task_header_size = sizeof(std::uint64_t) + sizeof(std::int32_t);
+
+        /**
+         * @brief Receives the next message on @p comm (of arbitrary size) into @p buffer.
+         * @param[in] comm the intercommunicator
+         * @param[in] status the status of the already probed message
+         * @param[out] buffer the received message
+         *
+         * @calls{
+         * int MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count);                                         // exactly once
+         * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // exactly once
+         * }
+         */
+        inline void worker_pool_receive(const MPI_Comm comm, const MPI_Status& status, std::vector<std::byte>& buffer) {
+            int count;
+            MPI_Get_count(&status, MPI_BYTE, &count);
+            buffer.resize(static_cast<std::size_t>(count));
+            MPI_Recv(buffer.data(), count, MPI_BYTE, status.MPI_SOURCE, status.MPI_TAG, comm, MPI_STATUS_IGNORE);
+        }
+
+        /**
+         * @brief Appends the object representation of @p value to @p buffer.
+         * @tparam T a trivially copyable type
+         * @param[inout] buffer the buffer to append to
+         * @param[in] value the value to append
+         */
+        template <typename T>
+        inline void worker_pool_append(std::vector<std::byte>& buffer, const T value) {
+            const auto* data = reinterpret_cast<const std::byte*>(&value);
+            buffer.insert(buffer.end(), data, data + sizeof(T));
+        }
+
+        /**
+         * @brief Reads a value of type @p T from the beginning of @p buffer.
+         * @tparam T a trivially copyable type
+         * @param[in] buffer the buffer to read from
+         * @return the read value
+         *
+         * @pre @p buffer **must** contain at least `sizeof(T)` bytes.
+         *
+         * @assert_precondition{ If @p buffer is too small. }
+         */
+        template <typename T>
+        inline T worker_pool_read(const std::span<const std::byte> buffer) {
+            MPICXX_ASSERT_PRECONDITION(buffer.size() >= sizeof(T),
+                    "Attempt to read {} bytes from a buffer of size {}!", sizeof(T), buffer.size());
+
+            T value;
+            std::memcpy(&value, buffer.data(), sizeof(T));
+            return value;
+        }
+
+        /**
+         * @brief Checks whether @p intercomm is an intercommunicator whose local group only contains the calling process.
+         * @param[in] intercomm the communicator to check
+         * @return `true` if @p intercomm can be used by a @ref mpicxx::worker_pool, otherwise `false`
+         *
+         * @calls{
+         * int MPI_Comm_test_inter(MPI_Comm comm, int *flag);    // at most once
+         * int MPI_Comm_size(MPI_Comm comm, int *size);          // at most once
+         * }
+         */
+        inline bool worker_pool_legal_intercomm(const MPI_Comm intercomm) {
+            if (intercomm == MPI_COMM_NULL) {
+                return false;
+            }
+            int flag, size;
+            MPI_Comm_test_inter(intercomm, &flag);
+            if (flag == 0) {
+                return false;
+            }
+            MPI_Comm_size(intercomm, &size);
+            return size == 1;
+        }
+
+    }
+
+
+    /**
+     * @nosubgrouping
+     * @brief A pool of warm worker processes spawned once and reused for multiple tasks.
+     * @details The workers are spawned via a @ref mpicxx::multiple_spawner (or adopted via an already existing intercommunicator) and
+     *          **must** enter @ref mpicxx::worker_loop() after initializing the MPI environment. A task consists of a function id and a
+     *          serialized payload, which are sent over the intercommunicator (@ref mpicxx::spawn_result::intercommunicator()) to an idle
+     *          worker. The worker replies with a serialized result. \n
+     *          This replaces one (expensive) spawn per job with one spawn per pool, i.e. the spawn latency is only paid once.
+     *
+     *          The pool is owned by exactly one process, i.e. the spawner's communicator **must** be
+     *          [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+     *
+     *    Example: @snippet examples/startup/worker_pool.cpp worker pool
+     */
+    class worker_pool {
+    public:
+        /// Unsigned integer type.
+        using size_type = std::size_t;
+        /// The type of the ticket identifying a submitted task.
+        using ticket_type = std::uint64_t;
+        /// The type of the function id identifying the task handler on the worker side.
+        using function_id_type = std::int32_t;
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                        constructors and destructor                                         //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name constructors and destructor
+        ///@{
+        /**
+         * @brief Spawns the workers described by @p spawner.
+         * @param[in] spawner the spawner used to spawn the workers
+         *
+         * @pre The communicator of @p spawner **must** be [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the communicator of @p spawner isn't
+         *                       [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @throws std::runtime_error if no worker could be spawned
+         *
+         * @calls{
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Comm_remote_size(MPI_Comm comm, int *size);                                                                                                                                                                          // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        explicit worker_pool(const multiple_spawner& spawner) {
+            mpicxx::ensure_initialized();
+            this->grow(spawner);
+        }
+        /**
+         * @brief Adopts the already running workers reachable via @p intercomm.
+         * @details All processes in the remote group of @p intercomm **must** call @ref mpicxx::worker_loop(MPI_Comm, Handler&&) with
+         *          their side of @p intercomm. The pool takes the ownership of @p intercomm, i.e. disconnects it on @ref shutdown().
+         * @param[in] intercomm the intercommunicator connecting the pool with the workers
+         *
+         * @pre @p intercomm **must** be an intercommunicator whose local group only contains the calling process.
+         *
+         * @assert_precondition{ If @p intercomm is no intercommunicator or its local group contains more than one process. }
+         *
+         * @calls{
+         * int MPI_Comm_test_inter(MPI_Comm comm, int *flag);      // at most once
+         * int MPI_Comm_size(MPI_Comm comm, int *size);            // at most once
+         * int MPI_Comm_remote_size(MPI_Comm comm, int *size);     // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        explicit worker_pool(const MPI_Comm intercomm) {
+            mpicxx::ensure_initialized();
+            this->grow(intercomm);
+        }
+        /**
+         * @brief Deleted copy constructor.
+         */
+        worker_pool(const worker_pool&) = delete;
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        worker_pool& operator=(const worker_pool&) = delete;
+        /**
+         * @brief Shuts down all workers (if not already done via @ref shutdown()). The results of all outstanding tasks are discarded.
+         */
+        ~worker_pool() {
+            if (!intercomms_.empty() && mpicxx::active()) {
+                [[maybe_unused]] const auto results = this->shutdown();
+            }
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                  resizing                                                  //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name resizing
+        ///@{
+        /**
+         * @brief Spawns additional workers described by @p spawner and adds them to the pool.
+         * @details The already running workers are **not** affected.
+         * @param[in] spawner the spawner used to spawn the additional workers
+         *
+         * @pre The communicator of @p spawner **must** be [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm).
+         *
+         * @assert_precondition{ If the communicator of @p spawner isn't
+         *                       [*MPI_COMM_SELF*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node149.htm). }
+         *
+         * @throws std::runtime_error if no worker could be spawned
+         *
+         * @calls{
+         * int MPI_Comm_spawn_multiple(int count, char *array_of_commands[], char **array_of_argv[], const int array_of_maxprocs[], const MPI_Info array_of_info[], int root, MPI_Comm comm, MPI_Comm *intercomm, int array_of_errcodes[]);    // exactly once
+         * int MPI_Comm_remote_size(MPI_Comm comm, int *size);                                                                                                                                                                          // exactly once
+         * }
+         */
+        void grow(const multiple_spawner& spawner) {
+            MPICXX_ASSERT_PRECONDITION(spawner.communicator() == MPI_COMM_SELF,
+                    "A worker_pool must be owned by exactly one process, i.e. the spawner's communicator must be MPI_COMM_SELF!");
+
+            const spawn_result res = spawner.freeze().spawn();
+            const MPI_Comm intercomm = res.intercommunicator();
+            if (intercomm == MPI_COMM_NULL) {
+                throw std::runtime_error("Couldn't spawn any worker!");
+            }
+            this->grow(intercomm);
+        }
+        /**
+         * @brief Adopts the additional, already running workers reachable via @p intercomm and adds them to the pool.
+         * @details The already running workers are **not** affected. All processes in the remote group of @p intercomm **must** call
+         *          @ref mpicxx::worker_loop(MPI_Comm, Handler&&) with their side of @p intercomm. The pool takes the ownership of
+         *          @p intercomm, i.e. disconnects it on @ref shutdown().
+         * @param[in] intercomm the intercommunicator connecting the pool with the additional workers
+         *
+         * @pre @p intercomm **must** be an intercommunicator whose local group only contains the calling process.
+         *
+         * @assert_precondition{ If @p intercomm is no intercommunicator or its local group contains more than one process. }
+         *
+         * @calls{
+         * int MPI_Comm_test_inter(MPI_Comm comm, int *flag);      // at most once
+         * int MPI_Comm_size(MPI_Comm comm, int *size);            // at most once
+         * int MPI_Comm_remote_size(MPI_Comm comm, int *size);     // exactly once
+         * + the MPI functions called by mpicxx::ensure_initialized()
+         * }
+         */
+        void grow(const MPI_Comm intercomm) {
+            mpicxx::ensure_initialized();
+            MPICXX_ASSERT_PRECONDITION(detail::worker_pool_legal_intercomm(intercomm),
+                    "A worker_pool requires an intercommunicator whose local group only contains the calling process!");
+
+            int remote_size;
+            MPI_Comm_remote_size(intercomm, &remote_size);
+
+            // register the new workers (all of them are idle)
+            intercomms_.push_back(intercomm);
+            offsets_.push_back(workers_.size());
+            for (int rank = 0; rank < remote_size; ++rank) {
+                idle_.push_back(workers_.size());
+                workers_.emplace_back(intercomm, rank);
+            }
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                              task processing                                               //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name task processing
+        ///@{
+        /**
+         * @brief Sends the task identified by @p id with the serialized @p payload to an idle worker.
+         * @details If all workers are busy, blocks until a worker finishes its current task (the result gets buffered and can be retrieved
+         *          via @ref wait_any() or @ref drain()).
+         * @param[in] id the function id identifying the task handler on the worker side
+         * @param[in] payload the serialized task arguments
+         * @return the ticket identifying the task result
+         *
+         * @pre The pool **must not** be shut down.
+         *
+         * @assert_precondition{ If the pool has already been shut down. }
+         *
+         * @calls{
+         * int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm);    // exactly once
+         * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                               // at most once if all workers are busy
+         * int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status);                   // arbitrary often if all workers are busy
+         * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // at most once
+         * }
+         */
+        ticket_type submit(const function_id_type id, const std::span<const std::byte> payload) {
+            MPICXX_ASSERT_PRECONDITION(!intercomms_.empty(), "Attempt to submit a task to a worker_pool which has already been shut down!");
+
+            // wait until at least one worker is idle
+            while (idle_.empty()) {
+                this->receive_result();
+            }
+            const size_type worker = idle_.back();
+            idle_.pop_back();
+
+            // message layout: [ticket][function id][payload]
+            const ticket_type ticket = next_ticket_++;
+            std::vector<std::byte> message;
+            message.reserve(sizeof(ticket_type) + sizeof(function_id_type) + payload.size());
+            detail::worker_pool_append(message, ticket);
+            detail::worker_pool_append(message, id);
+            message.insert(message.end(), payload.begin(), payload.end());
+
+            const auto& [intercomm, rank] = workers_[worker];
+            MPI_Send(message.data(), static_cast<int>(message.size()), MPI_BYTE, rank, detail::worker_pool_task_tag, intercomm);
+            return ticket;
+        }
+        /**
+         * @brief Returns the result of the next finished task, blocking until one is available.
+         * @return the task result
+         *
+         * @pre At least one task result **must** be outstanding.
+         *
+         * @assert_precondition{ If no task result is outstanding. }
+         *
+         * @calls{
+         * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                               // at most once
+         * int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status);                   // arbitrary often
+         * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // at most once
+         * }
+         */
+        worker_task_result wait_any() {
+            MPICXX_ASSERT_PRECONDITION(this->in_flight() > 0 || !completed_.empty(), "Attempt to wait for a task result without any task!");
+
+            if (completed_.empty()) {
+                this->receive_result();
+            }
+            worker_task_result res = std::move(completed_.front());
+            completed_.pop_front();
+            return res;
+        }
+        /**
+         * @brief Waits until all submitted tasks have been finished and returns all not yet retrieved task results.
+         * @details Afterwards all workers are idle.
+         * @return the task results (in the order they have been finished)
+         *
+         * @calls{
+         * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                               // at most 'this->in_flight()' times
+         * int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status);                   // arbitrary often
+         * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // exactly 'this->in_flight()' times
+         * }
+         */
+        std::vector<worker_task_result> drain() {
+            while (this->in_flight() > 0) {
+                this->receive_result();
+            }
+            std::vector<worker_task_result> results(std::make_move_iterator(completed_.begin()), std::make_move_iterator(completed_.end()));
+            completed_.clear();
+            return results;
+        }
+        /**
+         * @brief Drains the pool (see @ref drain()), tells all workers to leave @ref mpicxx::worker_loop() and disconnects from them.
+         * @details Afterwards no more tasks may be submitted.
+         * @return the not yet retrieved task results
+         *
+         * @calls{
+         * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                               // at most 'this->in_flight()' times
+         * int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status);                   // arbitrary often
+         * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // exactly 'this->in_flight()' times
+         * int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm);    // exactly 'this->size()' times
+         * int MPI_Comm_disconnect(MPI_Comm *comm);                                                              // once per call to the constructor or grow()
+         * }
+         */
+        std::vector<worker_task_result> shutdown() {
+            MPICXX_ASSERT_PRECONDITION(!intercomms_.empty(), "Attempt to shut down a worker_pool which has already been shut down!");
+
+            std::vector<worker_task_result> results = this->drain();
+            // an empty task message tells the worker to leave the worker_loop()
+            for (const auto& [intercomm, rank] : workers_) {
+                MPI_Send(nullptr, 0, MPI_BYTE, rank, detail::worker_pool_task_tag, intercomm);
+            }
+            for (MPI_Comm& intercomm : intercomms_) {
+                MPI_Comm_disconnect(&intercomm);
+            }
+            intercomms_.clear();
+            offsets_.clear();
+            workers_.clear();
+            idle_.clear();
+            return results;
+        }
+        ///@}
+
+
+        // ---------------------------------------------------------------------------------------------------------- //
+        //                                                   getter                                                   //
+        // ---------------------------------------------------------------------------------------------------------- //
+        /// @name getter
+        ///@{
+        /**
+         * @brief Returns the number of workers.
+         * @return the number of workers (`0` if the pool has been shut down)
+         * @nodiscard
+         */
+        [[nodiscard]]
+        size_type size() const noexcept { return workers_.size(); }
+        /**
+         * @brief Returns the number of idle workers.
+         * @return the number of idle workers
+         * @nodiscard
+         */
+        [[nodiscard]]
+        size_type idle() const noexcept { return idle_.size(); }
+        /**
+         * @brief Returns the number of submitted tasks whose result hasn't been received yet.
+         * @return the number of busy workers
+         * @nodiscard
+         */
+        [[nodiscard]]
+        size_type in_flight() const noexcept { return workers_.size() - idle_.size(); }
+        ///@}
+
+
+    private:
+        /*
+         * @brief Receives the next task result (blocking), marks the respective worker as idle and buffers the result.
+         *
+         * @calls{
+         * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                               // at most once
+         * int MPI_Iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status);                   // arbitrary often
+         * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // exactly once
+         * }
+         */
+        void receive_result() {
+            MPI_Status status;
+            size_type idx = 0;
+            if (intercomms_.size() == 1) {
+                MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, intercomms_.front(), &status);
+            } else {
+                // the workers are spread over multiple intercommunicators -> poll all of them
+                int flag;
+                while (true) {
+                    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, intercomms_[idx], &flag, &status);
+                    if (flag != 0) {
+                        break;
+                    }
+                    idx = (idx + 1) % intercomms_.size();
+                    if (idx == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            // message layout: [ticket][payload]
+            std::vector<std::byte> message;
+            detail::worker_pool_receive(intercomms_[idx], status, message);
+            worker_task_result res;
+            res.ticket = detail::worker_pool_read<ticket_type>(message);
+            res.succeeded = status.MPI_TAG == detail::worker_pool_result_tag;
+            res.payload.assign(message.begin() + sizeof(ticket_type), message.end());
+            completed_.push_back(std::move(res));
+
+            idle_.push_back(offsets_[idx] + static_cast<size_type>(status.MPI_SOURCE));
+        }
+
+        std::vector<MPI_Comm> intercomms_;
+        std::vector<size_type> offsets_;
+        std::vector<std::pair<MPI_Comm, int>> workers_;
+        std::vector<size_type> idle_;
+        std::deque<worker_task_result> completed_;
+        ticket_type next_ticket_ = 0;
+    };
+
+
+    /**
+     * @brief The worker side of a @ref mpicxx::worker_pool connected via @p intercomm: processes tasks until the pool shuts down.
+     * @details For each received task @p handler gets called with the function id and the serialized payload. Its serialized result is
+     *          sent back to the pool. If @p handler throws an exception, the exception message (or `"unknown exception"` if it isn't
+     *          derived from [`std::exception`](https://en.cppreference.com/w/cpp/error/exception)) is sent back instead and the worker
+     *          continues with the next task. \n
+     *          Only messages with the task tag are received: all other messages (e.g. a payload sent via
+     *          @ref mpicxx::single_spawner::set_payload()) are left untouched. Task messages shorter than the task header are discarded
+     *          without a reply. \n
+     *          Disconnects @p intercomm before returning.
+     * @tparam Handler a callable with the signature `std::vector<std::byte>(mpicxx::worker_pool::function_id_type, std::span<const std::byte>)`
+     * @param[in] intercomm the intercommunicator connecting the worker with the pool
+     * @param[in] handler the task handler
+     * @return the number of processed tasks
+     *
+     * @calls{
+     * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                                                  // once per task + 1
+     * int MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count);                                         // once per task + 1
+     * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // once per task + 1
+     * int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm);                       // once per task
+     * int MPI_Comm_disconnect(MPI_Comm *comm);                                                                                 // exactly once
+     * }
+     */
+    template <typename Handler>
+    inline std::size_t worker_loop(MPI_Comm intercomm, Handler&& handler)
+            requires std::is_invocable_r_v<std::vector<std::byte>, Handler, worker_pool::function_id_type, std::span<const std::byte>>
+    {
+        std::size_t processed = 0;
+        std::vector<std::byte> message;
+        std::vector<std::byte> reply;
+        while (true) {
+            MPI_Status status;
+            MPI_Probe(MPI_ANY_SOURCE, detail::worker_pool_task_tag, intercomm, &status);
+            detail::worker_pool_receive(intercomm, status, message);
+            // an empty message tells the worker to shut down
+            if (message.empty()) {
+                break;
+            }
+            // malformed task -> no ticket to reply to
+            if (message.size() < detail::worker_pool_task_header_size) {
+                continue;
+            }
+
+            // message layout: [ticket][function id][payload]
+            const std::span<const std::byte> buffer(message);
+            const auto ticket = detail::worker_pool_read<worker_pool::ticket_type>(buffer);
+            const auto id = detail::worker_pool_read<worker_pool::function_id_type>(buffer.subspan(sizeof(worker_pool::ticket_type)));
+
+            // reply layout: [ticket][payload]
+            reply.clear();
+            detail::worker_pool_append(reply, ticket);
+            const auto append_message = [&reply](const std::string_view what) {
+                const auto* data = reinterpret_cast<const std::byte*>(what.data());
+                reply.insert(reply.end(), data, data + what.size());
+            };
+            int tag = detail::worker_pool_result_tag;
+            try {
+                const std::vector<std::byte> res = std::invoke(handler, id, buffer.subspan(detail::worker_pool_task_header_size));
+                reply.insert(reply.end(), res.begin(), res.end());
+            } catch (const std::exception& e) {
+                append_message(e.what());
+                tag = detail::worker_pool_failure_tag;
+            } catch (...) {
+                append_message("unknown exception");
+                tag = detail::worker_pool_failure_tag;
+            }
+            MPI_Send(reply.data(), static_cast<int>(reply.size()), MPI_BYTE, status.MPI_SOURCE, tag, intercomm);
+            ++processed;
+        }
+
+        MPI_Comm_disconnect(&intercomm);
+        return processed;
+    }
+    /**
+     * @brief The worker side of a @ref mpicxx::worker_pool spawning the current process: processes tasks until the pool shuts down.
+     * @details Calls @ref mpicxx::worker_loop(MPI_Comm, Handler&&) with the intercommunicator to the parent process.
+     *
+     *    Example: @snippet examples/startup/worker_pool.cpp worker loop
+     * @tparam Handler a callable with the signature `std::vector<std::byte>(mpicxx::worker_pool::function_id_type, std::span<const std::byte>)`
+     * @param[in] handler the task handler
+     * @return the number of processed tasks
+     *
+     * @throws std::logic_error if the current process hasn't been spawned (see @ref mpicxx::parent_process())
+     *
+     * @calls{
+     * int MPI_Comm_get_parent(MPI_Comm *parent);                                                                              // exactly once
+     * int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status *status);                                                  // once per task + 1
+     * int MPI_Get_count(const MPI_Status *status, MPI_Datatype datatype, int *count);                                         // once per task + 1
+     * int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status *status);    // once per task + 1
+     * int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm);                       // once per task
+     * int MPI_Comm_disconnect(MPI_Comm *comm);                                                                                 // exactly once
+     * + the MPI functions called by mpicxx::ensure_initialized()
+     * }
+     */
+    template <typename Handler>
+    inline std::size_t worker_loop(Handler&& handler)
+            requires std::is_invocable_r_v<std::vector<std::byte>, Handler, worker_pool::function_id_type, std::span<const std::byte>>
+    {
+        mpicxx::ensure_initialized();
+        const std::optional<MPI_Comm> parent = mpicxx::parent_process();
+        if (!parent.has_value()) {
+            throw std::logic_error("worker_loop() may only be called from a process spawned by a worker_pool!");
+        }
+        return mpicxx::worker_loop(parent.value(), std::forward<Handler>(handler));
+    }
+
+}
+
+#endif // MPICXX_WORKER_POOL_HPP
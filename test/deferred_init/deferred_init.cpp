@@ -0,0 +1,51 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-16
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the deferred initialization of the MPI environment (see @ref mpicxx::defer_init() and
+ *        @ref mpicxx::ensure_initialized()) running **without** a previously initialized MPI environment.
+ * @details Testsuite: *DeferredInitTest*
+ * | test case name        | test case description                                                                |
+ * |:----------------------|:-------------------------------------------------------------------------------------|
+ * | FirstCallInitializes  | the first call of @ref mpicxx::parent_process() performs the deferred initialization |
+ * | InitializedAfterwards | further calls use the already initialized MPI environment                            |
+ */
+
+#include <mpicxx/chrono/clock.hpp>
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/spawn_result.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+TEST(DeferredInitTest, FirstCallInitializes) {
+    // the initialization has only been deferred by the main function
+    ASSERT_TRUE(mpicxx::detail::deferred_init.has_value());
+    ASSERT_FALSE(mpicxx::initialized());
+    ASSERT_FALSE(mpicxx::detail::deferred_init_done.load());
+
+    // the first mpicxx call which needs the MPI environment initializes it
+    const std::optional<MPI_Comm> parent = mpicxx::parent_process();
+    EXPECT_TRUE(mpicxx::initialized());
+    EXPECT_TRUE(mpicxx::active());
+    EXPECT_TRUE(mpicxx::detail::deferred_init_done.load());
+
+    // the test process hasn't been spawned
+    EXPECT_FALSE(parent.has_value());
+    // the initializing thread is the main thread
+    EXPECT_TRUE(mpicxx::is_main_thread());
+}
+
+TEST(DeferredInitTest, InitializedAfterwards) {
+    // the MPI environment must not be initialized again
+    ASSERT_TRUE(mpicxx::initialized());
+    EXPECT_NO_THROW(mpicxx::ensure_initialized());
+
+    // calls after the deferred initialization don't need any special handling
+    const mpicxx::clock::time_point start = mpicxx::clock::now();
+    EXPECT_LE(start, mpicxx::clock::now());
+    EXPECT_FALSE(mpicxx::parent_process().has_value());
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-16
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Main function of the deferred initialization tests: in contrast to the default test main function, the MPI environment isn't
+ *        initialized before running the tests, but only deferred via @ref mpicxx::defer_init(int&, char**).
+ */
+
+#include <mpicxx/startup/finalize.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <gtest/gtest.h>
+
+int main(int argc, char** argv) {
+    // Filter out Google Test arguments
+    ::testing::InitGoogleTest(&argc, argv);
+
+    // death tests aren't supported
+    ::testing::GTEST_FLAG(filter) = "-*DeathTest.*";
+
+    // Defer the initialization of MPI until the first mpicxx call which needs it
+    mpicxx::defer_init(argc, argv);
+
+    // Run tests
+    const int ret = RUN_ALL_TESTS();
+
+    // only finalize MPI if it has been initialized by the tests
+    if (mpicxx::initialized() && !mpicxx::finalized()) {
+        mpicxx::finalize();
+    }
+    return ret;
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::fingerprint() const member function provided by the @ref mpicxx::info class.
+ * @details Testsuite: *NonMemberFunctionTest*
+ * | test case name              | test case description                                                                                                    |
+ * |:----------------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | FingerprintEmpty            | the fingerprints of empty info objects are equal                                                                         |
+ * | FingerprintOrderIndependent | the fingerprint doesn't depend on the insertion order                                                                    |
+ * | FingerprintDifferent        | different [key, value]-pairs result in different fingerprints                                                            |
+ * | FingerprintSnapshot         | the fingerprint of a snapshot is equal to the fingerprint of the info object                                             |
+ * | FingerprintMaxValueSize     | value with the maximum possible length                                                                                   |
+ * | NullFingerprint             | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstdint>
+#include <string>
+
+namespace {
+    // sets the longest value accepted by the MPI implementation: max_value_size() characters if possible (allowed by the MPI standard,
+    // but rejected by some implementations), otherwise max_value_size() - 1 characters
+    std::string set_longest_value(MPI_Info info, const char* key, const char c) {
+        MPI_Errhandler errhandler;
+        MPI_Comm_get_errhandler(MPI_COMM_WORLD, &errhandler);
+        MPI_Comm_set_errhandler(MPI_COMM_WORLD, MPI_ERRORS_RETURN);
+        std::string value(mpicxx::info::max_value_size(), c);
+        if (MPI_Info_set(info, key, value.c_str()) != MPI_SUCCESS) {
+            value.pop_back();
+            MPI_Info_set(info, key, value.c_str());
+        }
+        MPI_Comm_set_errhandler(MPI_COMM_WORLD, errhandler);
+        MPI_Errhandler_free(&errhandler);
+        return value;
+    }
+}
+
+TEST(NonMemberFunctionTest, FingerprintEmpty) {
+    // create two empty info objects
+    mpicxx::info info_1;
+    mpicxx::info info_2;
+
+    // the fingerprints should be equal
+    EXPECT_EQ(info_1.fingerprint(), info_2.fingerprint());
+}
+
+TEST(NonMemberFunctionTest, FingerprintOrderIndependent) {
+    // create two info objects with the same [key, value]-pairs in a different order
+    mpicxx::info info_1 = { { "key1", "value1" }, { "key2", "value2" }, { "key3", "value3" } };
+    mpicxx::info info_2 = { { "key3", "value3" }, { "key1", "value1" }, { "key2", "value2" } };
+
+    // the fingerprints should be equal
+    EXPECT_EQ(info_1.fingerprint(), info_2.fingerprint());
+}
+
+TEST(NonMemberFunctionTest, FingerprintDifferent) {
+    // create info objects with different [key, value]-pairs
+    mpicxx::info info_1 = { { "key1", "value1" } };
+    mpicxx::info info_2 = { { "key1", "value2" } };
+    mpicxx::info info_3 = { { "key2", "value1" } };
+    mpicxx::info info_4 = { { "key", "1value1" } };
+    mpicxx::info info_5 = { { "key1", "value1" }, { "key2", "value2" } };
+    mpicxx::info info_6;
+
+    // the fingerprints should be different
+    EXPECT_NE(info_1.fingerprint(), info_2.fingerprint());
+    EXPECT_NE(info_1.fingerprint(), info_3.fingerprint());
+    EXPECT_NE(info_1.fingerprint(), info_4.fingerprint());
+    EXPECT_NE(info_1.fingerprint(), info_5.fingerprint());
+    EXPECT_NE(info_1.fingerprint(), info_6.fingerprint());
+
+    // changing a value changes the fingerprint
+    const auto fingerprint = info_5.fingerprint();
+    MPI_Info_set(info_5.get(), "key2", "value3");
+    EXPECT_NE(info_5.fingerprint(), fingerprint);
+}
+
+TEST(NonMemberFunctionTest, FingerprintSnapshot) {
+    // create info object
+    mpicxx::info info = { { "key1", "value1" }, { "key2", "value2" } };
+
+    // the fingerprint of the snapshot should be the same as the one of the info object
+    EXPECT_EQ(info.snapshot().fingerprint(), info.fingerprint());
+}
+
+TEST(NonMemberFunctionTest, FingerprintMaxValueSize) {
+    // create info objects containing a value with the maximum possible length (only settable via the MPI functions)
+    mpicxx::info info_1;
+    const std::string value = set_longest_value(info_1.get(), "key", 'x');
+    mpicxx::info info_2;
+    set_longest_value(info_2.get(), "key", 'x');
+    mpicxx::info info_3;
+    MPI_Info_set(info_3.get(), "key", value.substr(1).c_str());
+
+    // the whole value must be part of the fingerprint
+    EXPECT_EQ(info_1.fingerprint(), info_2.fingerprint());
+    EXPECT_NE(info_1.fingerprint(), info_3.fingerprint());
+    EXPECT_EQ(info_1.snapshot().fingerprint(), info_1.fingerprint());
+}
+
+TEST(NonMemberFunctionDeathTest, NullFingerprint) {
+    // create null info object
+    mpicxx::info info(MPI_INFO_NULL, false);
+
+    // calling fingerprint() on an info object referring to MPI_INFO_NULL is illegal
+    [[maybe_unused]] std::uint64_t fingerprint;
+    ASSERT_DEATH( fingerprint = info.fingerprint() , "");
+}
@@ -0,0 +1,162 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::from_file(const std::filesystem::path&) and
+ *        @ref mpicxx::info::from_file(const std::filesystem::path&, const int, const MPI_Comm) member functions provided by the
+ *        @ref mpicxx::info class.
+ * @details Testsuite: *NonMemberFunctionTest*
+ * | test case name                | test case description                                                         |
+ * |:------------------------------|:------------------------------------------------------------------------------|
+ * | FromFile                      | read a simple hints file                                                      |
+ * | FromFileCommentsWhitespace    | comments, empty lines and surrounding whitespace are ignored                  |
+ * | FromFileDuplicatedKey         | the last occurrence of a key determines the final value                       |
+ * | FromEmptyFile                 | reading an empty file results in an empty info object                         |
+ * | FromFileMissingValue          | a line without a value results in an exception                                |
+ * | FromFileIllegalKeyOrValue     | a key or value exceeding its size limit results in an exception               |
+ * | FromNonExistingFile           | a non-existing file results in an exception                                   |
+ * | FromFileCollective            | the file is only read on the root process and broadcasted to all processes    |
+ * | FromNonExistingFileCollective | a non-existing file results in an exception on all processes                  |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace {
+    // RAII helper creating a temporary hints file
+    class temporary_file {
+    public:
+        explicit temporary_file(const std::string& content) {
+            int rank;
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            path_ = std::filesystem::temp_directory_path() / ("mpicxx_hints_" + std::to_string(rank) + ".txt");
+            std::ofstream out(path_, std::ios::binary);
+            out << content;
+        }
+        ~temporary_file() { std::filesystem::remove(path_); }
+        const std::filesystem::path& path() const noexcept { return path_; }
+    private:
+        std::filesystem::path path_;
+    };
+}
+
+TEST(NonMemberFunctionTest, FromFile) {
+    // create hints file
+    temporary_file file("cb_buffer_size 16777216\nromio_cb_read enable\n");
+
+    // read hints file
+    mpicxx::info info = mpicxx::info::from_file(file.path());
+
+    // check [key, value]-pairs
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(std::as_const(info).at("cb_buffer_size"), "16777216");
+    EXPECT_EQ(std::as_const(info).at("romio_cb_read"), "enable");
+    EXPECT_TRUE(info.freeable());
+}
+
+TEST(NonMemberFunctionTest, FromFileCommentsWhitespace) {
+    // create hints file
+    temporary_file file("# comment\n\n   \t\n  key1 \t value1   # trailing comment\r\nkey2 value with spaces\nkey3 value3");
+
+    // read hints file
+    mpicxx::info info = mpicxx::info::from_file(file.path());
+
+    // check [key, value]-pairs
+    ASSERT_EQ(info.size(), 3);
+    EXPECT_EQ(std::as_const(info).at("key1"), "value1");
+    EXPECT_EQ(std::as_const(info).at("key2"), "value with spaces");
+    EXPECT_EQ(std::as_const(info).at("key3"), "value3");
+}
+
+TEST(NonMemberFunctionTest, FromFileDuplicatedKey) {
+    // create hints file
+    temporary_file file("key value1\nkey value2\n");
+
+    // read hints file
+    mpicxx::info info = mpicxx::info::from_file(file.path());
+
+    // the last occurrence determines the final value
+    ASSERT_EQ(info.size(), 1);
+    EXPECT_EQ(std::as_const(info).at("key"), "value2");
+}
+
+TEST(NonMemberFunctionTest, FromEmptyFile) {
+    // create empty hints file
+    temporary_file file("");
+
+    // read hints file
+    mpicxx::info info = mpicxx::info::from_file(file.path());
+
+    // the info object should be empty
+    EXPECT_TRUE(info.empty());
+}
+
+TEST(NonMemberFunctionTest, FromFileMissingValue) {
+    // create hints file with a missing value
+    temporary_file file("key1 value1\nkey2\n");
+
+    // reading the hints file should throw
+    EXPECT_THROW([[maybe_unused]] auto info = mpicxx::info::from_file(file.path()), std::invalid_argument);
+}
+
+TEST(NonMemberFunctionTest, FromFileIllegalKeyOrValue) {
+    // create hints files with an illegal key or value
+    temporary_file key_file(std::string(MPI_MAX_INFO_KEY, 'k') + " value\n");
+    EXPECT_THROW([[maybe_unused]] auto info = mpicxx::info::from_file(key_file.path()), std::invalid_argument);
+
+    temporary_file value_file("key " + std::string(MPI_MAX_INFO_VAL, 'v') + "\n");
+    EXPECT_THROW([[maybe_unused]] auto info = mpicxx::info::from_file(value_file.path()), std::invalid_argument);
+}
+
+TEST(NonMemberFunctionTest, FromNonExistingFile) {
+    // reading a non-existing file should throw
+    EXPECT_THROW([[maybe_unused]] auto info = mpicxx::info::from_file("mpicxx_non_existing_hints_file.txt"), std::system_error);
+}
+
+TEST(NonMemberFunctionTest, FromFileCollective) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // create hints file only on the root process
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "mpicxx_hints_collective.txt";
+    if (rank == 0) {
+        std::ofstream out(path);
+        out << "key1 value1\nkey2 value2\n";
+    }
+
+    // read hints file on the root process only
+    mpicxx::info info = mpicxx::info::from_file(path, 0, MPI_COMM_WORLD);
+    if (rank == 0) {
+        std::filesystem::remove(path);
+    }
+
+    // all processes should have the same info object
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(std::as_const(info).at("key1"), "value1");
+    EXPECT_EQ(std::as_const(info).at("key2"), "value2");
+}
+
+TEST(NonMemberFunctionTest, FromNonExistingFileCollective) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // reading a non-existing file should throw on all processes
+    if (rank == 0) {
+        EXPECT_THROW([[maybe_unused]] auto info = mpicxx::info::from_file("mpicxx_non_existing_hints_file.txt", 0, MPI_COMM_WORLD),
+                     std::system_error);
+    } else {
+        EXPECT_THROW([[maybe_unused]] auto info = mpicxx::info::from_file("mpicxx_non_existing_hints_file.txt", 0, MPI_COMM_WORLD),
+                     std::runtime_error);
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::pack() const and @ref mpicxx::info::unpack(const std::span<const std::byte>) member
+ *        functions provided by the @ref mpicxx::info class.
+ * @details Testsuite: *NonMemberFunctionTest*
+ * | test case name      | test case description                                                                                                    |
+ * |:--------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | PackEmpty           | pack and unpack an empty info object                                                                                     |
+ * | PackRoundTrip       | pack and unpack an info object with multiple [key, value]-pairs                                                          |
+ * | PackLayout          | check the layout of the packed buffer                                                                                    |
+ * | UnpackIllegalBuffer | try to unpack truncated or otherwise illegal buffers                                                                     |
+ * | NullPack            | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(NonMemberFunctionTest, PackEmpty) {
+    // create empty info object
+    mpicxx::info info;
+
+    // pack info object
+    const std::vector<std::byte> buffer = info.pack();
+    EXPECT_EQ(buffer.size(), sizeof(std::uint32_t));
+
+    // unpack info object
+    const mpicxx::info unpacked = mpicxx::info::unpack(buffer);
+    EXPECT_TRUE(unpacked.empty());
+    EXPECT_TRUE(unpacked.freeable());
+}
+
+TEST(NonMemberFunctionTest, PackRoundTrip) {
+    // create info object
+    mpicxx::info info = { { "key1", "value1" }, { "key2", "value2" }, { "key3", std::string(MPI_MAX_INFO_VAL - 1, 'x') } };
+
+    // pack and unpack info object
+    const mpicxx::info unpacked = mpicxx::info::unpack(info.pack());
+
+    // the unpacked info object should be equal to the original one (including the order)
+    ASSERT_EQ(unpacked.size(), 3);
+    EXPECT_EQ(unpacked, info);
+    EXPECT_EQ(unpacked.keys(), info.keys());
+}
+
+TEST(NonMemberFunctionTest, PackLayout) {
+    // create info object
+    mpicxx::info info = { { "key", "value" } };
+
+    // pack info object
+    const std::vector<std::byte> buffer = info.pack();
+    ASSERT_EQ(buffer.size(), 3 * sizeof(std::uint32_t) + 3 + 5);
+
+    // check the layout
+    std::uint32_t size;
+    std::memcpy(&size, buffer.data(), sizeof(size));
+    EXPECT_EQ(size, 1);
+    std::memcpy(&size, buffer.data() + sizeof(size), sizeof(size));
+    EXPECT_EQ(size, 3);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(buffer.data() + 2 * sizeof(size)), 3), "key");
+    std::memcpy(&size, buffer.data() + 2 * sizeof(size) + 3, sizeof(size));
+    EXPECT_EQ(size, 5);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(buffer.data() + 3 * sizeof(size) + 3), 5), "value");
+}
+
+TEST(NonMemberFunctionTest, UnpackIllegalBuffer) {
+    // create info object and pack it
+    mpicxx::info info = { { "key", "value" } };
+    std::vector<std::byte> buffer = info.pack();
+
+    // empty buffer
+    EXPECT_THROW([[maybe_unused]] auto i = mpicxx::info::unpack(std::span<const std::byte>{}), std::invalid_argument);
+
+    // truncated buffer
+    for (std::size_t i = 1; i < buffer.size(); ++i) {
+        EXPECT_THROW([[maybe_unused]] auto i2 = mpicxx::info::unpack(std::span<const std::byte>(buffer.data(), i)), std::invalid_argument);
+    }
+
+    // trailing bytes
+    std::vector<std::byte> trailing = buffer;
+    trailing.push_back(std::byte{ 0 });
+    EXPECT_THROW([[maybe_unused]] auto i = mpicxx::info::unpack(trailing), std::invalid_argument);
+
+    // key with an illegal size
+    std::vector<std::byte> illegal = buffer;
+    const std::uint32_t zero = 0;
+    std::memcpy(illegal.data() + sizeof(std::uint32_t), &zero, sizeof(zero));
+    EXPECT_THROW([[maybe_unused]] auto i = mpicxx::info::unpack(illegal), std::invalid_argument);
+}
+
+TEST(NonMemberFunctionDeathTest, NullPack) {
+    // create null info object
+    mpicxx::info info(MPI_INFO_NULL, false);
+
+    // calling pack() on an info object referring to MPI_INFO_NULL is illegal
+    [[maybe_unused]] std::vector<std::byte> buffer;
+    ASSERT_DEATH( buffer = info.pack() , "");
+}
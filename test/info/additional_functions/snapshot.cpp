@@ -0,0 +1,121 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::snapshot() const member function provided by the @ref mpicxx::info class.
+ * @details Testsuite: *NonMemberFunctionTest*
+ * | test case name     | test case description                                                                                                    |
+ * |:-------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | EmptySnapshot      | empty info object                                                                                                        |
+ * | Snapshot           | info object with [key, value]-pairs                                                                                      |
+ * | SnapshotIsDetached | changes to the info object aren't reflected in the snapshot                                                              |
+ * | MovedSnapshot      | moving a snapshot doesn't invalidate the [key, value]-pairs                                                              |
+ * | LongValueSnapshot  | values exceeding the initially reserved arena characters                                                                 |
+ * | NullSnapshot       | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+TEST(NonMemberFunctionTest, EmptySnapshot) {
+    // create empty info object
+    mpicxx::info info;
+
+    // snapshot should be empty
+    mpicxx::info::snapshot_type snapshot = info.snapshot();
+    EXPECT_TRUE(snapshot.empty());
+    EXPECT_EQ(snapshot.size(), 0);
+    EXPECT_EQ(snapshot.begin(), snapshot.end());
+}
+
+TEST(NonMemberFunctionTest, Snapshot) {
+    // create info object and add [key, value]-pairs
+    mpicxx::info info;
+    MPI_Info_set(info.get(), "key1", "value1");
+    MPI_Info_set(info.get(), "key2", " ");
+    MPI_Info_set(info.get(), "key3", "a longer value3");
+
+    // take a snapshot
+    const auto snapshot = info.snapshot();
+    ASSERT_EQ(snapshot.size(), 3);
+    EXPECT_EQ(std::distance(snapshot.begin(), snapshot.end()), 3);
+
+    // compare [key, value]-pairs to the ones obtained through the info iterators
+    std::size_t i = 0;
+    for (const auto& [key, value] : info) {
+        SCOPED_TRACE(i);
+        EXPECT_EQ(snapshot[i].first, key);
+        EXPECT_EQ(snapshot[i].second, static_cast<std::string>(value));
+        // both string_views are null-terminated
+        EXPECT_EQ(snapshot[i].first.data()[snapshot[i].first.size()], '\0');
+        EXPECT_EQ(snapshot[i].second.data()[snapshot[i].second.size()], '\0');
+        ++i;
+    }
+    EXPECT_EQ(snapshot[2].second, "a longer value3");
+}
+
+TEST(NonMemberFunctionTest, SnapshotIsDetached) {
+    // create info object with [key, value]-pair and take a snapshot
+    mpicxx::info info = { { "key", "value" } };
+    const auto snapshot = info.snapshot();
+
+    // change the info object
+    info["key"] = "value_override";
+    info["key2"] = "value2";
+
+    // the snapshot is unaffected
+    ASSERT_EQ(snapshot.size(), 1);
+    EXPECT_EQ(snapshot[0].first, "key");
+    EXPECT_EQ(snapshot[0].second, "value");
+}
+
+TEST(NonMemberFunctionTest, MovedSnapshot) {
+    // create info object and take a snapshot
+    mpicxx::info info = { { "key1", "value1" }, { "key2", "value2" } };
+    auto snapshot = info.snapshot();
+    const std::string_view key = snapshot[1].first;
+
+    // move the snapshot
+    mpicxx::info::snapshot_type moved(std::move(snapshot));
+    ASSERT_EQ(moved.size(), 2);
+    EXPECT_EQ(moved[1].first.data(), key.data());
+    EXPECT_EQ(moved[1].second, "value2");
+}
+
+TEST(NonMemberFunctionTest, LongValueSnapshot) {
+    // create info object with values longer than initially reserved in the arena
+    mpicxx::info info;
+    const std::string long_value(200, 'x');
+    MPI_Info_set(info.get(), "key1", "value1");
+    MPI_Info_set(info.get(), "key2", long_value.c_str());
+    MPI_Info_set(info.get(), "key3", "value3");
+
+    // the arena grows while taking the snapshot
+    const auto snapshot = info.snapshot();
+    ASSERT_EQ(snapshot.size(), 3);
+    EXPECT_EQ(snapshot[0].first, "key1");
+    EXPECT_EQ(snapshot[0].second, "value1");
+    EXPECT_EQ(snapshot[1].first, "key2");
+    EXPECT_EQ(snapshot[1].second, long_value);
+    EXPECT_EQ(snapshot[2].first, "key3");
+    EXPECT_EQ(snapshot[2].second, "value3");
+    EXPECT_EQ(snapshot.fingerprint(), info.fingerprint());
+}
+
+TEST(NonMemberFunctionDeathTest, NullSnapshot) {
+    // create null info object
+    mpicxx::info info(MPI_INFO_NULL, false);
+
+    // calling snapshot() on an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( [[maybe_unused]] const auto snapshot = info.snapshot() , "");
+}
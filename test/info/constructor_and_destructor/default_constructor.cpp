@@ -6,12 +6,14 @@
  *
  * @brief Test cases for the @ref mpicxx::info::info() member function provided by the @ref mpicxx::info class.
  * @details Testsuite: *ConstructionTest*
- * | test case name      | test case description         |
- * |:--------------------|:------------------------------|
- * | DefaultConstruction | default construct info object |
+ * | test case name           | test case description                                                       |
+ * |:-------------------------|:----------------------------------------------------------------------------|
+ * | DefaultConstruction      | default construct info object                                               |
+ * | DeferredInitConstruction | default construct an info object after the initialization has been deferred |
  */
 
 #include <mpicxx/info/info.hpp>
+#include <mpicxx/startup/init.hpp>
 
 #include <gtest/gtest.h>
 #include <mpi.h>
@@ -30,4 +32,20 @@ TEST(ConstructionTest, DefaultConstruction) {
 
     // a default constructed info object is always freeable
     EXPECT_TRUE(info.freeable());
+}
+
+TEST(ConstructionTest, DeferredInitConstruction) {
+    // simulate a deferred initialization (see mpicxx::defer_init())
+    ASSERT_FALSE(mpicxx::detail::deferred_init_done.load());
+    mpicxx::detail::deferred_init = mpicxx::detail::deferred_init_parameters{};
+
+    // constructing an info object needs an initialized MPI environment -> the deferred initialization must be performed
+    mpicxx::info info;
+    EXPECT_TRUE(mpicxx::detail::deferred_init_done.load());
+    EXPECT_NE(info.get(), MPI_INFO_NULL);
+    EXPECT_TRUE(mpicxx::initialized());
+
+    // reset the deferred initialization
+    mpicxx::detail::deferred_init.reset();
+    mpicxx::detail::deferred_init_done.store(false);
 }
\ No newline at end of file
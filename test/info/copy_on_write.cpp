@@ -0,0 +1,259 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the copy-on-write mode (@ref mpicxx::info::set_copy_on_write(const bool)) provided by the @ref mpicxx::info class.
+ * @details Testsuite: *CopyOnWriteTest*
+ * | test case name             | test case description                                                         |
+ * |:---------------------------|:------------------------------------------------------------------------------|
+ * | DisabledByDefault          | copy-on-write mode is disabled by default, i.e. copies call MPI_Info_dup      |
+ * | CopySharesHandle           | copies share the MPI_Info object and inherit the copy-on-write mode           |
+ * | CopyAssignmentSharesHandle | copy assignment shares the MPI_Info object                                    |
+ * | ModifyCopy                 | modifying a copy duplicates the MPI_Info object (the original is unchanged)   |
+ * | ModifyOriginal             | modifying the original duplicates the MPI_Info object (the copy is unchanged) |
+ * | ModifyingAccess            | all modifying member functions duplicate the shared MPI_Info object           |
+ * | LastOwnerKeepsHandle       | the last info object sharing the MPI_Info object doesn't duplicate it         |
+ * | Freeable                   | the freeable state stays correct                                              |
+ * | NonFreeableIsDuplicated    | non-freeable info objects are always duplicated                               |
+ * | Swap                       | swapping info objects in copy-on-write mode                                   |
+ * | ConcurrentCopies           | the same const info object can be copied concurrently                         |
+ * | DisableCopyOnWrite         | disabling the copy-on-write mode                                              |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(CopyOnWriteTest, DisabledByDefault) {
+    // create info object
+    mpicxx::info info = { { "key", "value" } };
+    EXPECT_FALSE(info.copy_on_write());
+
+    // copies refer to another MPI_Info object
+    mpicxx::info copy(info);
+    EXPECT_NE(std::as_const(info).get(), std::as_const(copy).get());
+    EXPECT_FALSE(copy.copy_on_write());
+}
+
+TEST(CopyOnWriteTest, CopySharesHandle) {
+    // create info object with copy-on-write mode enabled
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+
+    // copies share the same MPI_Info object
+    const mpicxx::info copy_1(info);
+    const mpicxx::info copy_2(copy_1);
+    EXPECT_EQ(std::as_const(info).get(), copy_1.get());
+    EXPECT_EQ(copy_1.get(), copy_2.get());
+    EXPECT_TRUE(copy_1.copy_on_write());
+    EXPECT_TRUE(copy_2.copy_on_write());
+
+    // reading doesn't duplicate the MPI_Info object
+    EXPECT_EQ(copy_1.at("key"), "value");
+    EXPECT_TRUE(copy_2.contains("key"));
+    EXPECT_EQ(copy_1, copy_2);
+    EXPECT_EQ(copy_1.get(), copy_2.get());
+}
+
+TEST(CopyOnWriteTest, CopyAssignmentSharesHandle) {
+    // create info objects with copy-on-write mode enabled
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+    mpicxx::info copy;
+
+    // copy assignment shares the same MPI_Info object
+    copy = info;
+    EXPECT_EQ(std::as_const(info).get(), std::as_const(copy).get());
+    EXPECT_TRUE(copy.copy_on_write());
+}
+
+TEST(CopyOnWriteTest, ModifyCopy) {
+    // create info object with copy-on-write mode enabled and copy it
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+    mpicxx::info copy(info);
+
+    // modify the copy
+    copy["key"] = "value_override";
+    copy.insert("key2", "value2");
+
+    // the copy now refers to another MPI_Info object
+    EXPECT_NE(std::as_const(info).get(), std::as_const(copy).get());
+    EXPECT_EQ(std::as_const(copy).at("key"), "value_override");
+    EXPECT_EQ(copy.size(), 2);
+    // the original is unchanged
+    EXPECT_EQ(std::as_const(info).at("key"), "value");
+    EXPECT_EQ(info.size(), 1);
+}
+
+TEST(CopyOnWriteTest, ModifyOriginal) {
+    // create info object with copy-on-write mode enabled and copy it
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+    const mpicxx::info copy(info);
+
+    // modify the original
+    info.erase("key");
+
+    // the copy is unchanged
+    EXPECT_TRUE(info.empty());
+    EXPECT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy.at("key"), "value");
+}
+
+TEST(CopyOnWriteTest, ModifyingAccess) {
+    // create info object with copy-on-write mode enabled
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+
+    // all modifying accesses must duplicate the shared MPI_Info object
+    const auto check = [&](auto&& func) {
+        mpicxx::info copy(info);
+        func(copy);
+        EXPECT_NE(std::as_const(info).get(), std::as_const(copy).get());
+    };
+    check([](mpicxx::info& i) { i.insert_or_assign("key", "value2"); });
+    check([](mpicxx::info& i) { i.set("key", 42); });
+    check([](mpicxx::info& i) { i.clear(); });
+    check([](mpicxx::info& i) { i.begin()->second = "value2"; });
+    check([](mpicxx::info& i) { i.find("key")->second = "value2"; });
+    check([](mpicxx::info& i) { [[maybe_unused]] const auto pair = i.extract("key"); });
+    check([](mpicxx::info& i) { erase_if(i, [](const auto&) { return true; }); });
+    check([](mpicxx::info& i) { [[maybe_unused]] MPI_Info& handle = i.get(); });
+    check([](mpicxx::info& i) { mpicxx::info other = { { "key2", "value2" } }; i.merge(other); });
+
+    // the original is unchanged
+    ASSERT_EQ(info.size(), 1);
+    EXPECT_EQ(std::as_const(info).at("key"), "value");
+}
+
+TEST(CopyOnWriteTest, LastOwnerKeepsHandle) {
+    // create info object with copy-on-write mode enabled
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+    const MPI_Info handle = std::as_const(info).get();
+
+    {
+        // create and destroy a copy
+        mpicxx::info copy(info);
+    }
+
+    // no other info object shares the MPI_Info object -> modifications don't duplicate it
+    info.insert("key2", "value2");
+    EXPECT_EQ(std::as_const(info).get(), handle);
+    EXPECT_EQ(info.size(), 2);
+}
+
+TEST(CopyOnWriteTest, Freeable) {
+    // create info object with copy-on-write mode enabled
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+
+    // all copies are freeable
+    mpicxx::info copy(info);
+    EXPECT_TRUE(info.freeable());
+    EXPECT_TRUE(copy.freeable());
+
+    // moved-from objects aren't freeable
+    mpicxx::info moved(std::move(copy));
+    EXPECT_FALSE(copy.freeable());
+    EXPECT_TRUE(moved.freeable());
+    EXPECT_EQ(std::as_const(moved).get(), std::as_const(info).get());
+    EXPECT_TRUE(moved.copy_on_write());
+}
+
+TEST(CopyOnWriteTest, NonFreeableIsDuplicated) {
+    // create non-freeable info object with copy-on-write mode enabled
+    MPI_Info handle;
+    MPI_Info_create(&handle);
+    {
+        mpicxx::info info(handle, false);
+        info.set_copy_on_write(true);
+
+        // the copy must not share the MPI_Info object (since it isn't owned by the info object)
+        mpicxx::info copy(info);
+        EXPECT_NE(std::as_const(copy).get(), handle);
+        EXPECT_TRUE(copy.freeable());
+        EXPECT_FALSE(info.freeable());
+    }
+    MPI_Info_free(&handle);
+}
+
+TEST(CopyOnWriteTest, Swap) {
+    // create info objects
+    mpicxx::info info_1 = { { "key1", "value1" } };
+    info_1.set_copy_on_write(true);
+    mpicxx::info copy(info_1);
+    mpicxx::info info_2 = { { "key2", "value2" } };
+
+    // swap the info objects
+    info_2.swap(copy);
+
+    // info_2 now shares the MPI_Info object with info_1
+    EXPECT_EQ(std::as_const(info_1).get(), std::as_const(info_2).get());
+    EXPECT_TRUE(info_2.copy_on_write());
+    EXPECT_FALSE(copy.copy_on_write());
+
+    // modifying info_2 doesn't change info_1
+    info_2.insert("key3", "value3");
+    EXPECT_EQ(info_1.size(), 1);
+    EXPECT_EQ(info_2.size(), 2);
+}
+
+TEST(CopyOnWriteTest, ConcurrentCopies) {
+    // create info object with copy-on-write mode enabled
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+    const mpicxx::info& const_info = info;
+    const MPI_Info handle = const_info.get();
+
+    // copy the same const info object from multiple threads (no MPI call is performed)
+    std::atomic<int> not_shared = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < 100; ++i) {
+                const mpicxx::info copy(const_info);
+                if (copy.get() != handle) {
+                    ++not_shared;
+                }
+            }
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(not_shared, 0);
+
+    // the original is unchanged and still owns the MPI_Info object
+    EXPECT_EQ(const_info.get(), handle);
+    EXPECT_EQ(const_info.at("key"), "value");
+}
+
+TEST(CopyOnWriteTest, DisableCopyOnWrite) {
+    // create info object with copy-on-write mode enabled and copy it
+    mpicxx::info info = { { "key", "value" } };
+    info.set_copy_on_write(true);
+    mpicxx::info copy(info);
+    EXPECT_EQ(std::as_const(info).get(), std::as_const(copy).get());
+
+    // disable the copy-on-write mode -> new copies call MPI_Info_dup
+    info.set_copy_on_write(false);
+    const mpicxx::info other_copy(info);
+    EXPECT_NE(std::as_const(info).get(), other_copy.get());
+    EXPECT_FALSE(other_copy.copy_on_write());
+
+    // modifying the info object still doesn't change the shared copy
+    info.insert("key2", "value2");
+    EXPECT_EQ(info.size(), 2);
+    EXPECT_EQ(copy.size(), 1);
+}
\ No newline at end of file
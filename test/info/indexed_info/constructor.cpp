@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the constructors and @ref mpicxx::indexed_info::reindex() member function provided by the
+ *        @ref mpicxx::indexed_info class.
+ * @details Testsuite: *IndexedInfoConstructorTest*
+ * | test case name         | test case description                                                                                                   |
+ * |:-----------------------|:------------------------------------------------------------------------------------------------------------------------|
+ * | DefaultConstruct       | default construct an empty indexed info object                                                                          |
+ * | ConstructFromInfo      | construct an indexed info object from an existing info object                                                           |
+ * | InitializerList        | construct an indexed info object from an initializer list                                                               |
+ * | CopyConstruct          | copy construct an indexed info object (retaining the key order)                                                         |
+ * | Reindex                | rebuild the hash index after modifying the underlying *MPI_Info* object directly                                        |
+ * | ConstructFromNullInfo  | construct an indexed info object from an info object referring to *MPI_INFO_NULL* (death test)                          |
+ */
+
+#include <mpicxx/info/indexed_info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <utility>
+
+TEST(IndexedInfoConstructorTest, DefaultConstruct) {
+    // default construct an indexed info object
+    mpicxx::indexed_info info;
+
+    // check that the info object is empty
+    EXPECT_TRUE(info.empty());
+    EXPECT_EQ(info.size(), 0);
+    EXPECT_EQ(info.base().size(), 0);
+    EXPECT_EQ(info.begin(), info.end());
+}
+
+TEST(IndexedInfoConstructorTest, ConstructFromInfo) {
+    // create info object with [key, value]-pairs and index it
+    mpicxx::info base = { { "key1", "value1" }, { "key2", "value2" }, { "key3", "value3" } };
+    mpicxx::indexed_info info(std::move(base));
+
+    // check that the index has been build correctly
+    ASSERT_EQ(info.size(), 3);
+    EXPECT_TRUE(info.contains("key1"));
+    EXPECT_TRUE(info.contains("key2"));
+    EXPECT_TRUE(info.contains("key3"));
+    EXPECT_FALSE(info.contains("key4"));
+    EXPECT_EQ(info.at("key2"), "value2");
+}
+
+TEST(IndexedInfoConstructorTest, InitializerList) {
+    // construct an indexed info object from an initializer list containing a duplicated key
+    mpicxx::indexed_info info = { { "key1", "value1" }, { "key2", "value2" }, { "key1", "value1_override" } };
+
+    // check that the index has been build correctly
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(info.at("key1"), "value1_override");
+    EXPECT_EQ(info.at("key2"), "value2");
+}
+
+TEST(IndexedInfoConstructorTest, CopyConstruct) {
+    // create indexed info object and copy it
+    mpicxx::indexed_info info = { { "key1", "value1" }, { "key2", "value2" } };
+    mpicxx::indexed_info copy(info);
+
+    // the copy has its own MPI_Info object
+    EXPECT_NE(info.get(), copy.get());
+
+    // check that the copied index is still valid
+    ASSERT_EQ(copy.size(), 2);
+    auto it = copy.find("key2");
+    ASSERT_NE(it, copy.end());
+    EXPECT_EQ(it->first, "key2");
+    EXPECT_EQ(it->second, "value2");
+}
+
+TEST(IndexedInfoConstructorTest, Reindex) {
+    // create indexed info object
+    mpicxx::indexed_info info = { { "key1", "value1" } };
+
+    // modify the underlying MPI_Info object directly
+    MPI_Info_set(info.get(), "key2", "value2");
+    EXPECT_FALSE(info.contains("key2"));
+
+    // rebuild the index
+    info.reindex();
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_TRUE(info.contains("key2"));
+    EXPECT_EQ(info.find("key2")->second, "value2");
+}
+
+TEST(IndexedInfoConstructorDeathTest, ConstructFromNullInfo) {
+    // create info object referring to MPI_INFO_NULL
+    mpicxx::info base(MPI_INFO_NULL, false);
+
+    // indexing an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( mpicxx::indexed_info info(std::move(base)) , "");
+}
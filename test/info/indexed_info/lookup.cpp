@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the lookup member functions provided by the @ref mpicxx::indexed_info class.
+ * @details Testsuite: *IndexedInfoLookupTest*
+ * | test case name       | test case description                                              |
+ * |:---------------------|:-------------------------------------------------------------------|
+ * | FindExisting         | find keys in indexed info object                                   |
+ * | FindNonExisting      | find non-existing key in indexed info object                       |
+ * | ContainsAndCount     | check for existing and non-existing keys                           |
+ * | EqualRange           | get the range of existing and non-existing keys                    |
+ * | MatchesInfo          | all lookups return the same positions as the plain info object     |
+ * | AtNonExisting        | access a non-existing key (throws)                                 |
+ */
+
+#include <mpicxx/info/indexed_info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+#include <test_utility.hpp>
+
+#include <stdexcept>
+#include <string>
+
+TEST(IndexedInfoLookupTest, FindExisting) {
+    // create indexed info object
+    const mpicxx::indexed_info info = { { "key1", "value1" }, { "key2", "value2" } };
+
+    // try finding the keys
+    mpicxx::indexed_info::const_iterator it_1 = info.find("key1");
+    ASSERT_NE(it_1, info.cend());
+    EXPECT_STREQ(it_1->first.c_str(), "key1");
+    EXPECT_STREQ(it_1->second.c_str(), "value1");
+
+    auto it_2 = info.find("key2");
+    ASSERT_NE(it_2, info.cend());
+    EXPECT_STREQ(it_2->first.c_str(), "key2");
+    EXPECT_STREQ(it_2->second.c_str(), "value2");
+}
+
+TEST(IndexedInfoLookupTest, FindNonExisting) {
+    // create indexed info object
+    const mpicxx::indexed_info info = { { "key1", "value1" } };
+
+    // try finding non-existing key
+    EXPECT_EQ(info.find("key2"), info.end());
+}
+
+TEST(IndexedInfoLookupTest, ContainsAndCount) {
+    // create indexed info object
+    const mpicxx::indexed_info info = { { "key1", "value1" } };
+
+    // check for existing and non-existing keys
+    EXPECT_TRUE(info.contains("key1"));
+    EXPECT_FALSE(info.contains("key2"));
+    EXPECT_EQ(info.count("key1"), 1);
+    EXPECT_EQ(info.count("key2"), 0);
+}
+
+TEST(IndexedInfoLookupTest, EqualRange) {
+    // create indexed info object
+    const mpicxx::indexed_info info = { { "key1", "value1" }, { "key2", "value2" } };
+
+    // get range of an existing key
+    auto [first, last] = info.equal_range("key1");
+    EXPECT_EQ(first, info.begin());
+    EXPECT_EQ(last, info.begin() + 1);
+
+    // get range of a non-existing key
+    auto [first_non, last_non] = info.equal_range("key3");
+    EXPECT_EQ(first_non, info.end());
+    EXPECT_EQ(last_non, info.end());
+}
+
+TEST(IndexedInfoLookupTest, MatchesInfo) {
+    // create indexed info object with a lot of keys
+    mpicxx::indexed_info info;
+    for (int i = 0; i < 64; ++i) {
+        info.insert("key" + std::to_string(i), "value" + std::to_string(i));
+    }
+
+    // all lookups must yield the same position as the linear search of the plain info object
+    for (int i = 0; i < 64; ++i) {
+        const std::string key = "key" + std::to_string(i);
+        EXPECT_EQ(info.find(key) - info.begin(), info.base().find(key) - info.base().begin());
+        EXPECT_EQ(info.find(key)->second, "value" + std::to_string(i));
+    }
+}
+
+TEST(IndexedInfoLookupTest, AtNonExisting) {
+    // create indexed info object
+    const mpicxx::indexed_info info = { { "key1", "value1" } };
+
+    // accessing a non-existing key throws
+    [[maybe_unused]] std::string val;
+    EXPECT_THROW_WHAT(val = info.at("key2"), std::out_of_range, "key2 doesn't exist!");
+}
@@ -0,0 +1,130 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the modifying member functions provided by the @ref mpicxx::indexed_info class.
+ * @details Testsuite: *IndexedInfoModifierTest*
+ * | test case name              | test case description                                                     |
+ * |:----------------------------|:--------------------------------------------------------------------------|
+ * | Insert                      | insert new and already existing keys                                      |
+ * | InsertOrAssign              | insert or assign new and already existing keys                            |
+ * | Erase                       | erase existing and non-existing keys (index positions are updated)        |
+ * | Clear                       | clear the indexed info object                                             |
+ * | InsertWithIllegalKeyOrValue | insert an illegal key or value (death test)                               |
+ * | EraseWithIllegalKey         | erase an illegal key (death test)                                         |
+ */
+
+#include <mpicxx/info/indexed_info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+
+TEST(IndexedInfoModifierTest, Insert) {
+    // create empty indexed info object
+    mpicxx::indexed_info info;
+
+    // insert new key
+    auto [it_1, inserted_1] = info.insert("key1", "value1");
+    EXPECT_TRUE(inserted_1);
+    EXPECT_EQ(it_1, info.begin());
+    EXPECT_EQ(it_1->first, "key1");
+
+    // insert another key
+    auto [it_2, inserted_2] = info.insert("key2", "value2");
+    EXPECT_TRUE(inserted_2);
+    EXPECT_EQ(it_2 - info.begin(), 1);
+    EXPECT_EQ(static_cast<std::string>(it_2->second), "value2");
+
+    // try inserting an already existing key
+    auto [it_3, inserted_3] = info.insert("key1", "value1_override");
+    EXPECT_FALSE(inserted_3);
+    EXPECT_EQ(it_3, info.begin());
+    EXPECT_EQ(info.at("key1"), "value1");
+
+    EXPECT_EQ(info.size(), 2);
+    EXPECT_EQ(info.base().size(), 2);
+}
+
+TEST(IndexedInfoModifierTest, InsertOrAssign) {
+    // create indexed info object
+    mpicxx::indexed_info info = { { "key1", "value1" } };
+
+    // assign an already existing key
+    auto [it_1, inserted_1] = info.insert_or_assign("key1", "value1_override");
+    EXPECT_FALSE(inserted_1);
+    EXPECT_EQ(it_1, info.begin());
+    EXPECT_EQ(info.at("key1"), "value1_override");
+
+    // insert a new key
+    auto [it_2, inserted_2] = info.insert_or_assign("key2", "value2");
+    EXPECT_TRUE(inserted_2);
+    EXPECT_EQ(it_2 - info.begin(), 1);
+    EXPECT_EQ(info.at("key2"), "value2");
+
+    EXPECT_EQ(info.size(), 2);
+}
+
+TEST(IndexedInfoModifierTest, Erase) {
+    // create indexed info object
+    mpicxx::indexed_info info = { { "key1", "value1" }, { "key2", "value2" }, { "key3", "value3" } };
+
+    // erase non-existing key
+    EXPECT_EQ(info.erase("key4"), 0);
+    EXPECT_EQ(info.size(), 3);
+
+    // erase the first key
+    EXPECT_EQ(info.erase("key1"), 1);
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(info.base().size(), 2);
+    EXPECT_FALSE(info.contains("key1"));
+
+    // the positions of the remaining keys must still be valid
+    auto it_2 = info.find("key2");
+    ASSERT_NE(it_2, info.end());
+    EXPECT_EQ(it_2->first, "key2");
+    auto it_3 = info.find("key3");
+    ASSERT_NE(it_3, info.end());
+    EXPECT_EQ(it_3->first, "key3");
+
+    // inserting after erasing must still work
+    info.insert("key1", "value1");
+    EXPECT_EQ(static_cast<std::string>(info.find("key1")->second), "value1");
+}
+
+TEST(IndexedInfoModifierTest, Clear) {
+    // create indexed info object
+    mpicxx::indexed_info info = { { "key1", "value1" }, { "key2", "value2" } };
+
+    // clear the indexed info object
+    info.clear();
+    EXPECT_TRUE(info.empty());
+    EXPECT_TRUE(info.base().empty());
+    EXPECT_FALSE(info.contains("key1"));
+}
+
+TEST(IndexedInfoModifierDeathTest, InsertWithIllegalKeyOrValue) {
+    // create indexed info object
+    mpicxx::indexed_info info;
+    std::string key(MPI_MAX_INFO_KEY, ' ');
+    std::string value(MPI_MAX_INFO_VAL, ' ');
+
+    // try inserting illegal keys or values
+    ASSERT_DEATH( info.insert(key, "value") , "");
+    ASSERT_DEATH( info.insert("", "value") , "");
+    ASSERT_DEATH( info.insert_or_assign("key", value) , "");
+    ASSERT_DEATH( info.insert_or_assign("key", "") , "");
+}
+
+TEST(IndexedInfoModifierDeathTest, EraseWithIllegalKey) {
+    // create indexed info object
+    mpicxx::indexed_info info;
+    std::string key(MPI_MAX_INFO_KEY, ' ');
+
+    // try erasing illegal keys
+    ASSERT_DEATH( info.erase(key) , "");
+    ASSERT_DEATH( info.erase("") , "");
+}
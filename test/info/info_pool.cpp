@@ -0,0 +1,187 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info_pool class used by the @ref mpicxx::info class.
+ * @details Testsuite: *InfoPoolTest*
+ * | test case name          | test case description                                               |
+ * |:------------------------|:--------------------------------------------------------------------|
+ * | DisabledByDefault       | the pool is disabled by default, i.e. no handles are parked         |
+ * | ParkAndReuse            | destroyed info objects park their handle, new info objects reuse it |
+ * | ParkedHandlesAreCleared | reused handles don't contain any [key, value]-pairs                 |
+ * | Capacity                | at most 'capacity' handles are parked                               |
+ * | ShrinkCapacity          | shrinking the capacity frees the surplus handles                    |
+ * | NonFreeableNotParked    | non-freeable info objects don't park their handle                   |
+ * | Statistics              | the statistics and hit rate are correct                             |
+ * | DisabledNoStatistics    | no statistics are collected while the pool is disabled              |
+ */
+
+#include <mpicxx/info/info.hpp>
+#include <mpicxx/info/info_pool.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <utility>
+#include <vector>
+
+namespace {
+    // RAII helper enabling the info pool for a single test case
+    class scoped_info_pool {
+    public:
+        explicit scoped_info_pool(const std::size_t capacity) {
+            mpicxx::info_pool::set_capacity(capacity);
+            mpicxx::info_pool::reset_statistics();
+        }
+        ~scoped_info_pool() {
+            mpicxx::info_pool::set_capacity(0);
+            mpicxx::info_pool::reset_statistics();
+        }
+    };
+}
+
+TEST(InfoPoolTest, DisabledByDefault) {
+    EXPECT_EQ(mpicxx::info_pool::capacity(), 0);
+
+    // create and destroy info object
+    {
+        mpicxx::info info = { { "key", "value" } };
+    }
+
+    // no handle should have been parked
+    EXPECT_EQ(mpicxx::info_pool::size(), 0);
+}
+
+TEST(InfoPoolTest, ParkAndReuse) {
+    scoped_info_pool pool(4);
+
+    // create and destroy info object
+    MPI_Info handle;
+    {
+        mpicxx::info info;
+        handle = std::as_const(info).get();
+    }
+
+    // the handle should have been parked
+    ASSERT_EQ(mpicxx::info_pool::size(), 1);
+
+    // a new info object should reuse the parked handle
+    mpicxx::info info;
+    EXPECT_EQ(std::as_const(info).get(), handle);
+    EXPECT_EQ(mpicxx::info_pool::size(), 0);
+    EXPECT_TRUE(info.freeable());
+}
+
+TEST(InfoPoolTest, ParkedHandlesAreCleared) {
+    scoped_info_pool pool(4);
+
+    // create and destroy info object with [key, value]-pairs
+    {
+        mpicxx::info info = { { "key1", "value1" }, { "key2", "value2" }, { "key3", "value3" } };
+    }
+
+    // the reused handle should be empty
+    mpicxx::info info;
+    EXPECT_TRUE(info.empty());
+    info.insert("key", "value");
+    ASSERT_EQ(info.size(), 1);
+    EXPECT_EQ(std::as_const(info).at("key"), "value");
+}
+
+TEST(InfoPoolTest, Capacity) {
+    scoped_info_pool pool(2);
+
+    // create and destroy more info objects than the capacity
+    {
+        std::vector<mpicxx::info> infos(3);
+    }
+
+    // only 'capacity' handles should have been parked
+    EXPECT_EQ(mpicxx::info_pool::size(), 2);
+    EXPECT_EQ(mpicxx::info_pool::statistics().parked, 2);
+    EXPECT_EQ(mpicxx::info_pool::statistics().dropped, 1);
+}
+
+TEST(InfoPoolTest, ShrinkCapacity) {
+    scoped_info_pool pool(4);
+
+    // park four handles
+    {
+        std::vector<mpicxx::info> infos(4);
+    }
+    ASSERT_EQ(mpicxx::info_pool::size(), 4);
+
+    // shrink the capacity
+    mpicxx::info_pool::set_capacity(1);
+    EXPECT_EQ(mpicxx::info_pool::capacity(), 1);
+    EXPECT_EQ(mpicxx::info_pool::size(), 1);
+
+    // clear the pool
+    mpicxx::info_pool::clear();
+    EXPECT_EQ(mpicxx::info_pool::size(), 0);
+    EXPECT_EQ(mpicxx::info_pool::capacity(), 1);
+}
+
+TEST(InfoPoolTest, NonFreeableNotParked) {
+    scoped_info_pool pool(4);
+
+    // create and destroy non-freeable info object
+    MPI_Info handle;
+    MPI_Info_create(&handle);
+    {
+        mpicxx::info info(handle, false);
+    }
+
+    // the handle shouldn't have been parked
+    EXPECT_EQ(mpicxx::info_pool::size(), 0);
+    MPI_Info_free(&handle);
+}
+
+TEST(InfoPoolTest, Statistics) {
+    scoped_info_pool pool(4);
+
+    // first info object can't be served from the pool
+    {
+        const mpicxx::info info;
+        EXPECT_EQ(mpicxx::info_pool::statistics().hits, 0);
+        EXPECT_EQ(mpicxx::info_pool::statistics().misses, 1);
+        EXPECT_EQ(mpicxx::info_pool::statistics().hit_rate(), 0.0);
+    }
+
+    // recreate the info object three times
+    for (int i = 0; i < 3; ++i) {
+        const mpicxx::info info;
+    }
+
+    // check statistics
+    const mpicxx::info_pool_statistics stats = mpicxx::info_pool::statistics();
+    EXPECT_EQ(stats.hits, 3);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.parked, 4);
+    EXPECT_EQ(stats.dropped, 0);
+    EXPECT_EQ(stats.hit_rate(), 0.75);
+
+    // reset statistics
+    mpicxx::info_pool::reset_statistics();
+    EXPECT_EQ(mpicxx::info_pool::statistics().hits, 0);
+    EXPECT_EQ(mpicxx::info_pool::statistics().hit_rate(), 0.0);
+}
+
+TEST(InfoPoolTest, DisabledNoStatistics) {
+    mpicxx::info_pool::reset_statistics();
+
+    // create and destroy info objects while the pool is disabled
+    for (int i = 0; i < 3; ++i) {
+        mpicxx::info info = { { "key", "value" } };
+    }
+
+    // the disabled pool isn't touched at all
+    const mpicxx::info_pool_statistics stats = mpicxx::info_pool::statistics();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 0);
+    EXPECT_EQ(stats.parked, 0);
+    EXPECT_EQ(stats.dropped, 0);
+    EXPECT_EQ(mpicxx::info_pool::size(), 0);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::get_into(const std::string_view, const std::span<char>) const member function provided by
+ *        the @ref mpicxx::info class.
+ * @details Testsuite: *ModifierTest*
+ * | test case name          | test case description                                                                                                    |
+ * |:------------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | GetInto                 | read value into a sufficiently large buffer                                                                              |
+ * | GetIntoTruncated        | read value into a too small buffer                                                                                       |
+ * | GetIntoEmptyBuffer      | read value into an empty buffer                                                                                          |
+ * | GetIntoNonExisting      | try to read a non-existing key                                                                                           |
+ * | NullGetInto             | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ * | GetIntoWithIllegalKey   | try to read an illegal key (death test)                                                                                  |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <array>
+#include <optional>
+#include <span>
+#include <string>
+
+TEST(ModifierTest, GetInto) {
+    // create info object
+    const mpicxx::info info = { { "key", "value" } };
+
+    // read existing value
+    std::array<char, 16> buffer{};
+    const std::optional<mpicxx::info::size_type> len = info.get_into("key", buffer);
+
+    // check if the value has been copied correctly
+    ASSERT_TRUE(len.has_value());
+    EXPECT_EQ(len.value(), 5);
+    EXPECT_STREQ(buffer.data(), "value");
+}
+
+TEST(ModifierTest, GetIntoTruncated) {
+    // create info object
+    const mpicxx::info info = { { "key", "long value" } };
+
+    // read existing value into a too small buffer
+    std::array<char, 5> buffer{};
+    const std::optional<mpicxx::info::size_type> len = info.get_into("key", buffer);
+
+    // the full length is returned but the value is truncated
+    ASSERT_TRUE(len.has_value());
+    EXPECT_EQ(len.value(), 10);
+    EXPECT_GE(len.value(), buffer.size());
+    EXPECT_STREQ(buffer.data(), "long");
+}
+
+TEST(ModifierTest, GetIntoEmptyBuffer) {
+    // create info object
+    const mpicxx::info info = { { "key", "value" } };
+
+    // query only the length
+    const std::optional<mpicxx::info::size_type> len = info.get_into("key", std::span<char>{});
+    ASSERT_TRUE(len.has_value());
+    EXPECT_EQ(len.value(), 5);
+}
+
+TEST(ModifierTest, GetIntoNonExisting) {
+    // create info object
+    const mpicxx::info info = { { "key", "value" } };
+
+    // try reading a non-existing key
+    std::array<char, 16> buffer = { 'a', '\0' };
+    EXPECT_FALSE(info.get_into("key2", buffer).has_value());
+
+    // the buffer is left unchanged
+    EXPECT_STREQ(buffer.data(), "a");
+}
+
+TEST(ModifierDeathTest, NullGetInto) {
+    // create null info object
+    const mpicxx::info info(MPI_INFO_NULL, false);
+    std::array<char, 16> buffer{};
+
+    // calling get_into() on an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( [[maybe_unused]] const auto len = info.get_into("key", buffer) , "");
+}
+
+TEST(ModifierDeathTest, GetIntoWithIllegalKey) {
+    // create info object
+    const mpicxx::info info;
+    std::string key(MPI_MAX_INFO_KEY, ' ');
+    std::array<char, 16> buffer{};
+
+    // try reading an illegal key
+    ASSERT_DEATH( [[maybe_unused]] const auto len = info.get_into(key, buffer) , "");
+    ASSERT_DEATH( [[maybe_unused]] const auto len = info.get_into("", buffer) , "");
+}
@@ -0,0 +1,150 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::insert_bulk(InputIt, InputIt) and
+ *        @ref mpicxx::info::insert_bulk(std::initializer_list<value_type>) member functions provided by the @ref mpicxx::info class.
+ * @details Testsuite: *ModifierTest*
+ * | test case name                              | test case description                                                                                                    |
+ * |:--------------------------------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | InsertBulkByIteratorRange                   | insert all [key, value]-pairs from the iterator range                                                                    |
+ * | InsertBulkByIteratorRangeWithDuplicates     | only the first occurrence of a key is inserted                                                                           |
+ * | InsertBulkByEmptyIteratorRange              | inserting an empty range is a no-op                                                                                      |
+ * | InsertBulkByInitializerList                 | insert all [key, value]-pairs from the initializer list                                                                  |
+ * | InsertBulkManyKeys                          | insert a large number of [key, value]-pairs                                                                              |
+ * | InsertBulkByIllegalIteratorRange            | illegal iterator range (death test)                                                                                      |
+ * | InsertBulkByIllegalKeyOrValue               | try to insert an illegal key or value (death test)                                                                       |
+ * | NullInsertBulk                              | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(ModifierTest, InsertBulkByIteratorRange) {
+    // create info object and add [key, value]-pair
+    mpicxx::info info;
+    MPI_Info_set(info.get(), "key1", "value1");
+
+    // create vector with [key, value]-pairs
+    std::vector<mpicxx::info::value_type> vec = { { "key1", "value1_override" }, { "key2", "value2" }, { "key3", "value3" } };
+
+    // insert [key, value]-pairs
+    EXPECT_EQ(info.insert_bulk(vec.begin(), vec.end()), 2);
+
+    // check if all [key, value]-pairs were inserted correctly
+    ASSERT_EQ(info.size(), 3);
+    EXPECT_EQ(std::as_const(info).at("key1"), "value1");
+    EXPECT_EQ(std::as_const(info).at("key2"), "value2");
+    EXPECT_EQ(std::as_const(info).at("key3"), "value3");
+}
+
+TEST(ModifierTest, InsertBulkByIteratorRangeWithDuplicates) {
+    // create empty info object
+    mpicxx::info info;
+
+    // create vector with duplicated keys
+    std::vector<mpicxx::info::value_type> vec = { { "key1", "value1" }, { "key2", "value2" },
+                                                  { "key1", "value1_override" }, { "key2", "value2_override" } };
+
+    // insert [key, value]-pairs
+    EXPECT_EQ(info.insert_bulk(vec.begin(), vec.end()), 2);
+
+    // the first occurrence determines the final value
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(std::as_const(info).at("key1"), "value1");
+    EXPECT_EQ(std::as_const(info).at("key2"), "value2");
+}
+
+TEST(ModifierTest, InsertBulkByEmptyIteratorRange) {
+    // create info object and add [key, value]-pair
+    mpicxx::info info;
+    MPI_Info_set(info.get(), "key", "value");
+
+    // insert empty range
+    std::vector<mpicxx::info::value_type> vec;
+    EXPECT_EQ(info.insert_bulk(vec.begin(), vec.end()), 0);
+
+    // nothing should have changed
+    ASSERT_EQ(info.size(), 1);
+    EXPECT_EQ(std::as_const(info).at("key"), "value");
+}
+
+TEST(ModifierTest, InsertBulkByInitializerList) {
+    // create info object and add [key, value]-pair
+    mpicxx::info info;
+    MPI_Info_set(info.get(), "key1", "value1");
+
+    // insert [key, value]-pairs
+    EXPECT_EQ(info.insert_bulk({ { "key1", "value1_override" }, { "key2", "value2" }, { "key2", "value2_override" } }), 1);
+
+    // check if all [key, value]-pairs were inserted correctly
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(std::as_const(info).at("key1"), "value1");
+    EXPECT_EQ(std::as_const(info).at("key2"), "value2");
+}
+
+TEST(ModifierTest, InsertBulkManyKeys) {
+    // create empty info object
+    mpicxx::info info;
+
+    // create vector with many [key, value]-pairs (every key twice)
+    std::vector<mpicxx::info::value_type> vec;
+    for (int i = 0; i < 1000; ++i) {
+        vec.emplace_back("key" + std::to_string(i % 500), "value" + std::to_string(i));
+    }
+
+    // insert [key, value]-pairs
+    EXPECT_EQ(info.insert_bulk(vec.begin(), vec.end()), 500);
+
+    // check if all [key, value]-pairs were inserted correctly
+    ASSERT_EQ(info.size(), 500);
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(std::as_const(info).at("key" + std::to_string(i)), "value" + std::to_string(i));
+    }
+}
+
+TEST(ModifierDeathTest, InsertBulkByIllegalIteratorRange) {
+    // create info object
+    mpicxx::info info;
+
+    // create vector with [key, value]-pair
+    std::vector<mpicxx::info::value_type> vec = { { "key", "value" } };
+
+    // try inserting with illegal iterator range
+    ASSERT_DEATH( info.insert_bulk(vec.end(), vec.begin()) , "");
+}
+
+TEST(ModifierDeathTest, InsertBulkByIllegalKeyOrValue) {
+    // create info object
+    mpicxx::info info;
+    std::string key(MPI_MAX_INFO_KEY, ' ');
+    std::string value(MPI_MAX_INFO_VAL, ' ');
+
+    // try inserting illegal keys
+    ASSERT_DEATH( info.insert_bulk({ { key, "value" } }) , "");
+    ASSERT_DEATH( info.insert_bulk({ { "", "value" } }) , "");
+
+    // try inserting illegal values
+    ASSERT_DEATH( info.insert_bulk({ { "key", value } }) , "");
+    ASSERT_DEATH( info.insert_bulk({ { "key", "" } }) , "");
+}
+
+TEST(ModifierDeathTest, NullInsertBulk) {
+    // create null info object
+    mpicxx::info info(MPI_INFO_NULL, false);
+
+    // create vector with [key, value]-pair
+    std::vector<mpicxx::info::value_type> vec = { { "key", "value" } };
+
+    // calling insert_bulk() on an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( info.insert_bulk(vec.begin(), vec.end()) , "");
+    ASSERT_DEATH( info.insert_bulk({ { "key", "value" } }) , "");
+}
@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::try_get(const std::string_view, std::string&) const member function provided by the
+ *        @ref mpicxx::info class.
+ * @details Testsuite: *ModifierTest*
+ * | test case name          | test case description                                                                                                    |
+ * |:------------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | TryGet                  | read value into a string                                                                                                 |
+ * | TryGetReusesCapacity    | read values into a string with sufficient capacity                                                                       |
+ * | TryGetNonExisting       | try to read a non-existing key                                                                                           |
+ * | NullTryGet              | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ * | TryGetWithIllegalKey    | try to read an illegal key (death test)                                                                                  |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+
+TEST(ModifierTest, TryGet) {
+    // create info object
+    const mpicxx::info info = { { "key", "value" } };
+
+    // read existing value
+    std::string value;
+    EXPECT_TRUE(info.try_get("key", value));
+    EXPECT_EQ(value, "value");
+}
+
+TEST(ModifierTest, TryGetReusesCapacity) {
+    // create info object
+    const mpicxx::info info = { { "key1", "a long value which doesn't fit into the small string buffer" }, { "key2", "short" } };
+
+    // read the long value first
+    std::string value;
+    ASSERT_TRUE(info.try_get("key1", value));
+    EXPECT_EQ(value, "a long value which doesn't fit into the small string buffer");
+    const char* data = value.data();
+
+    // reading the short value reuses the already allocated memory
+    ASSERT_TRUE(info.try_get("key2", value));
+    EXPECT_EQ(value, "short");
+    EXPECT_EQ(value.data(), data);
+}
+
+TEST(ModifierTest, TryGetNonExisting) {
+    // create info object
+    const mpicxx::info info = { { "key", "value" } };
+
+    // try reading a non-existing key
+    std::string value("unchanged");
+    EXPECT_FALSE(info.try_get("key2", value));
+    EXPECT_EQ(value, "unchanged");
+}
+
+TEST(ModifierDeathTest, NullTryGet) {
+    // create null info object
+    const mpicxx::info info(MPI_INFO_NULL, false);
+    std::string value;
+
+    // calling try_get() on an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( info.try_get("key", value) , "");
+}
+
+TEST(ModifierDeathTest, TryGetWithIllegalKey) {
+    // create info object
+    const mpicxx::info info;
+    std::string key(MPI_MAX_INFO_KEY, ' ');
+    std::string value;
+
+    // try reading an illegal key
+    ASSERT_DEATH( info.try_get(key, value) , "");
+    ASSERT_DEATH( info.try_get("", value) , "");
+}
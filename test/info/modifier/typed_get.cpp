@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::get(const std::string_view) const member function template provided by the
+ *        @ref mpicxx::info class.
+ * @details Testsuite: *ModifierTest*
+ * | test case name          | test case description                                                                                                    |
+ * |:------------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | TypedGetIntegral        | read integral values                                                                                                     |
+ * | TypedGetFloatingPoint   | read floating point values                                                                                               |
+ * | TypedGetBool            | read boolean values                                                                                                      |
+ * | TypedGetEnum            | read enum values                                                                                                         |
+ * | TypedGetNonExisting     | try to read a non-existing key                                                                                           |
+ * | TypedGetInvalidArgument | try to read values which aren't valid textual representations                                                            |
+ * | TypedGetOutOfRange      | try to read a value which doesn't fit into the requested type                                                            |
+ * | NullTypedGet            | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstdint>
+
+namespace {
+    enum class color { red = 1, green = 2 };
+}
+
+TEST(ModifierTest, TypedGetIntegral) {
+    // create info object
+    const mpicxx::info info = { { "int", "-42" }, { "size", "18446744073709551615" } };
+
+    // read integral values
+    const mpicxx::expected<int, mpicxx::info_errc> i = info.get<int>("int");
+    ASSERT_TRUE(i.has_value());
+    EXPECT_EQ(i.value(), -42);
+
+    const auto s = info.get<std::uint64_t>("size");
+    ASSERT_TRUE(s);
+    EXPECT_EQ(*s, UINT64_MAX);
+}
+
+TEST(ModifierTest, TypedGetFloatingPoint) {
+    // create info object
+    const mpicxx::info info = { { "double", "3.25" }, { "float", "-1e-3" } };
+
+    // read floating point values
+    const auto d = info.get<double>("double");
+    ASSERT_TRUE(d.has_value());
+    EXPECT_DOUBLE_EQ(d.value(), 3.25);
+
+    const auto f = info.get<float>("float");
+    ASSERT_TRUE(f.has_value());
+    EXPECT_FLOAT_EQ(f.value(), -1e-3f);
+}
+
+TEST(ModifierTest, TypedGetBool) {
+    // create info object
+    const mpicxx::info info = { { "true", "true" }, { "false", "false" }, { "invalid", "1" } };
+
+    // read boolean values
+    ASSERT_TRUE(info.get<bool>("true").has_value());
+    EXPECT_TRUE(info.get<bool>("true").value());
+    ASSERT_TRUE(info.get<bool>("false").has_value());
+    EXPECT_FALSE(info.get<bool>("false").value());
+
+    // only "true" and "false" are allowed
+    ASSERT_FALSE(info.get<bool>("invalid").has_value());
+    EXPECT_EQ(info.get<bool>("invalid").error(), mpicxx::info_errc::invalid_argument);
+}
+
+TEST(ModifierTest, TypedGetEnum) {
+    // create info object
+    const mpicxx::info info = { { "color", "2" } };
+
+    // read enum value
+    const auto c = info.get<color>("color");
+    ASSERT_TRUE(c.has_value());
+    EXPECT_EQ(c.value(), color::green);
+}
+
+TEST(ModifierTest, TypedGetNonExisting) {
+    // create info object
+    const mpicxx::info info;
+
+    // try reading a non-existing key
+    const auto i = info.get<int>("key");
+    ASSERT_FALSE(i.has_value());
+    EXPECT_EQ(i.error(), mpicxx::info_errc::key_not_found);
+    EXPECT_EQ(i.value_or(3), 3);
+}
+
+TEST(ModifierTest, TypedGetInvalidArgument) {
+    // create info object
+    const mpicxx::info info = { { "text", "abc" }, { "trailing", "42abc" }, { "leading", " 42" }, { "double", "4.2" } };
+
+    // try reading values which aren't valid integers
+    for (const char* key : { "text", "trailing", "leading", "double" }) {
+        SCOPED_TRACE(key);
+        const auto i = info.get<int>(key);
+        ASSERT_FALSE(i.has_value());
+        EXPECT_EQ(i.error(), mpicxx::info_errc::invalid_argument);
+    }
+}
+
+TEST(ModifierTest, TypedGetOutOfRange) {
+    // create info object
+    const mpicxx::info info = { { "key", "70000" } };
+
+    // try reading a value which doesn't fit into the requested type
+    const auto i = info.get<std::int16_t>("key");
+    ASSERT_FALSE(i.has_value());
+    EXPECT_EQ(i.error(), mpicxx::info_errc::result_out_of_range);
+}
+
+TEST(ModifierDeathTest, NullTypedGet) {
+    // create null info object
+    const mpicxx::info info(MPI_INFO_NULL, false);
+
+    // calling get<T>() on an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( [[maybe_unused]] const auto val = info.get<int>("key") , "");
+}
@@ -0,0 +1,114 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::set(const std::string_view, const T) member function template provided by the
+ *        @ref mpicxx::info class.
+ * @details Testsuite: *ModifierTest*
+ * | test case name          | test case description                                                                                                    |
+ * |:------------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | TypedSetIntegral        | insert integral values                                                                                                   |
+ * | TypedSetFloatingPoint   | insert floating point values (round-trip)                                                                                |
+ * | TypedSetBool            | insert boolean values                                                                                                    |
+ * | TypedSetEnum            | insert enum values                                                                                                       |
+ * | TypedSetOverride        | override an already existing value                                                                                       |
+ * | NullTypedSet            | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ * | TypedSetWithIllegalKey  | try to insert an illegal key (death test)                                                                                |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace {
+    enum class color { red = 1, green = 2 };
+}
+
+TEST(ModifierTest, TypedSetIntegral) {
+    // create empty info object
+    mpicxx::info info;
+
+    // insert integral values
+    info.set("int", -42);
+    info.set("size", std::numeric_limits<std::uint64_t>::max());
+
+    // check the textual representations
+    EXPECT_EQ(std::as_const(info).at("int"), "-42");
+    EXPECT_EQ(std::as_const(info).at("size"), "18446744073709551615");
+}
+
+TEST(ModifierTest, TypedSetFloatingPoint) {
+    // create empty info object
+    mpicxx::info info;
+
+    // insert floating point values
+    info.set("double", 0.1);
+    info.set("max", std::numeric_limits<double>::max());
+
+    // check the textual representation and the round-trip
+    EXPECT_EQ(std::as_const(info).at("double"), "0.1");
+    EXPECT_EQ(info.get<double>("double").value(), 0.1);
+    EXPECT_EQ(info.get<double>("max").value(), std::numeric_limits<double>::max());
+}
+
+TEST(ModifierTest, TypedSetBool) {
+    // create empty info object
+    mpicxx::info info;
+
+    // insert boolean values
+    info.set("true", true);
+    info.set("false", false);
+
+    // check the textual representations
+    EXPECT_EQ(std::as_const(info).at("true"), "true");
+    EXPECT_EQ(std::as_const(info).at("false"), "false");
+}
+
+TEST(ModifierTest, TypedSetEnum) {
+    // create empty info object
+    mpicxx::info info;
+
+    // insert enum value
+    info.set("color", color::green);
+
+    // check the textual representation and the round-trip
+    EXPECT_EQ(std::as_const(info).at("color"), "2");
+    EXPECT_EQ(info.get<color>("color").value(), color::green);
+}
+
+TEST(ModifierTest, TypedSetOverride) {
+    // create info object
+    mpicxx::info info = { { "key", "value" } };
+
+    // override the already existing value
+    info.set("key", 3);
+
+    EXPECT_EQ(info.size(), 1);
+    EXPECT_EQ(info.get<int>("key").value(), 3);
+}
+
+TEST(ModifierDeathTest, NullTypedSet) {
+    // create null info object
+    mpicxx::info info(MPI_INFO_NULL, false);
+
+    // calling set<T>() on an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( info.set("key", 42) , "");
+}
+
+TEST(ModifierDeathTest, TypedSetWithIllegalKey) {
+    // create info object
+    mpicxx::info info;
+    std::string key(MPI_MAX_INFO_KEY, ' ');
+
+    // try inserting an illegal key
+    ASSERT_DEATH( info.set(key, 42) , "");
+    ASSERT_DEATH( info.set("", 42) , "");
+}
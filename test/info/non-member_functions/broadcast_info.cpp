@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::broadcast_info(info&, const int, const MPI_Comm) function provided by the
+ *        @ref mpicxx::info class.
+ * @details Testsuite: *NonMemberFunctionTest*
+ * | test case name        | test case description                                                                                                    |
+ * |:----------------------|:-------------------------------------------------------------------------------------------------------------------------|
+ * | BroadcastInfo         | broadcast an info object from rank 0 to all other ranks                                                                  |
+ * | BroadcastEmptyInfo    | broadcast an empty info object                                                                                           |
+ * | BroadcastInfoLastRank | broadcast an info object from the last rank to all other ranks                                                           |
+ * | NullBroadcastInfo     | info object referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) (death test) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <utility>
+
+TEST(NonMemberFunctionTest, BroadcastInfo) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // create info object (different on the root process)
+    mpicxx::info info;
+    if (rank == 0) {
+        info.insert({ { "key1", "value1" }, { "key2", "value2" } });
+    } else {
+        info.insert("other_key", "other_value");
+    }
+
+    // broadcast the info object
+    broadcast_info(info, 0, MPI_COMM_WORLD);
+
+    // all processes should now have the same info object
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_EQ(std::as_const(info).at("key1"), "value1");
+    EXPECT_EQ(std::as_const(info).at("key2"), "value2");
+    EXPECT_FALSE(info.contains("other_key"));
+    EXPECT_TRUE(info.freeable());
+}
+
+TEST(NonMemberFunctionTest, BroadcastEmptyInfo) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // create info object (empty on the root process)
+    mpicxx::info info;
+    if (rank != 0) {
+        info.insert("key", "value");
+    }
+
+    // broadcast the info object
+    broadcast_info(info, 0, MPI_COMM_WORLD);
+
+    // all processes should now have an empty info object
+    EXPECT_TRUE(info.empty());
+}
+
+TEST(NonMemberFunctionTest, BroadcastInfoLastRank) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // create info object on the last process
+    mpicxx::info info;
+    if (rank == size - 1) {
+        info.insert("key", "value");
+    }
+
+    // broadcast the info object
+    broadcast_info(info, size - 1, MPI_COMM_WORLD);
+
+    // all processes should now have the same info object
+    ASSERT_EQ(info.size(), 1);
+    EXPECT_EQ(std::as_const(info).at("key"), "value");
+}
+
+TEST(NonMemberFunctionDeathTest, NullBroadcastInfo) {
+    // create null info object
+    mpicxx::info info(MPI_INFO_NULL, false);
+
+    // broadcasting an info object referring to MPI_INFO_NULL is illegal
+    ASSERT_DEATH( broadcast_info(info, 0, MPI_COMM_SELF) , "");
+}
@@ -0,0 +1,154 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::info::fast_equal(const info&, const info&) function provided by the @ref mpicxx::info class.
+ * @details Testsuite: *NonMemberFunctionTest*
+ * | test case name        | test case description                                                                                        |
+ * |:----------------------|:-------------------------------------------------------------------------------------------------------------|
+ * | FastEqual             | check various `fast_equal` cases                                                                             |
+ * | FastEqualOrder        | the insertion order doesn't influence the result                                                             |
+ * | FastEqualSymmetry     | `fast_equal(info1, info2)` <-> `fast_equal(info2, info1)`                                                    |
+ * | FastEqualSameAsEquals | `fast_equal(info1, info2)` <-> `info1 == info2`                                                              |
+ * | FastEqualMaxValueSize | values with the maximum possible length                                                                      |
+ * | NullFastEqual         | info objects referring to [*MPI_INFO_NULL*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node229.htm) |
+ */
+
+#include <mpicxx/info/info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+    // sets the longest value accepted by the MPI implementation: max_value_size() characters if possible (allowed by the MPI standard,
+    // but rejected by some implementations), otherwise max_value_size() - 1 characters
+    std::string set_longest_value(MPI_Info info, const char* key, const char c) {
+        MPI_Errhandler errhandler;
+        MPI_Comm_get_errhandler(MPI_COMM_WORLD, &errhandler);
+        MPI_Comm_set_errhandler(MPI_COMM_WORLD, MPI_ERRORS_RETURN);
+        std::string value(mpicxx::info::max_value_size(), c);
+        if (MPI_Info_set(info, key, value.c_str()) != MPI_SUCCESS) {
+            value.pop_back();
+            MPI_Info_set(info, key, value.c_str());
+        }
+        MPI_Comm_set_errhandler(MPI_COMM_WORLD, errhandler);
+        MPI_Errhandler_free(&errhandler);
+        return value;
+    }
+}
+
+TEST(NonMemberFunctionTest, FastEqual) {
+    // create two empty info objects
+    mpicxx::info info_1;
+    mpicxx::info info_2;
+
+    // info objects should compare equal
+    EXPECT_TRUE(fast_equal(info_1, info_2));
+    EXPECT_TRUE(fast_equal(info_1, info_1));
+
+    // add a [key, value]-pair to one info object
+    MPI_Info_set(info_1.get(), "key", "value");
+
+    // info objects should not compare equal
+    EXPECT_FALSE(fast_equal(info_1, info_2));
+
+    // add a [key, value]-pair with the same key, but a different value, to the other info object
+    MPI_Info_set(info_2.get(), "key", "other_value");
+
+    // info objects should still not compare equal
+    EXPECT_FALSE(fast_equal(info_1, info_2));
+
+    // add a [key, value]-pair with the same key and a different value of the same length
+    MPI_Info_set(info_2.get(), "key", "VALUE");
+
+    // info objects should still not compare equal
+    EXPECT_FALSE(fast_equal(info_1, info_2));
+
+    // change value in info_2 to match the one of info_1
+    MPI_Info_set(info_2.get(), "key", "value");
+
+    // info objects should compare equal again
+    EXPECT_TRUE(fast_equal(info_1, info_2));
+}
+
+TEST(NonMemberFunctionTest, FastEqualOrder) {
+    // create two info objects with the same [key, value]-pairs in a different order
+    mpicxx::info info_1 = { { "key1", "value1" }, { "key2", "value2" }, { "key3", "value3" } };
+    mpicxx::info info_2 = { { "key2", "value2" }, { "key3", "value3" }, { "key1", "value1" } };
+
+    // info objects should compare equal
+    EXPECT_TRUE(fast_equal(info_1, info_2));
+}
+
+TEST(NonMemberFunctionTest, FastEqualSymmetry) {
+    // create two info objects
+    mpicxx::info info_1 = { { "key1", "value1" } };
+    mpicxx::info info_2 = { { "key2", "value2" } };
+
+    // info objects should not compare equal
+    EXPECT_FALSE(fast_equal(info_1, info_2));
+    EXPECT_FALSE(fast_equal(info_2, info_1));
+
+    // make the info objects equal
+    MPI_Info_set(info_1.get(), "key2", "value2");
+    MPI_Info_set(info_2.get(), "key1", "value1");
+
+    // info objects should compare equal
+    EXPECT_TRUE(fast_equal(info_1, info_2));
+    EXPECT_TRUE(fast_equal(info_2, info_1));
+}
+
+TEST(NonMemberFunctionTest, FastEqualSameAsEquals) {
+    // create multiple info objects
+    std::vector<mpicxx::info> infos;
+    infos.emplace_back();
+    infos.emplace_back(mpicxx::info{ { "key1", "value1" } });
+    infos.emplace_back(mpicxx::info{ { "key1", "value2" } });
+    infos.emplace_back(mpicxx::info{ { "key1", "value1" }, { "key2", "value2" } });
+    infos.emplace_back(mpicxx::info{ { "key2", "value2" }, { "key1", "value1" } });
+
+    // fast_equal should always yield the same result as operator==
+    for (const mpicxx::info& lhs : infos) {
+        for (const mpicxx::info& rhs : infos) {
+            EXPECT_EQ(fast_equal(lhs, rhs), lhs == rhs);
+        }
+    }
+}
+
+TEST(NonMemberFunctionTest, FastEqualMaxValueSize) {
+    // create info objects containing a value with the maximum possible length (only settable via the MPI functions)
+    mpicxx::info info_1;
+    set_longest_value(info_1.get(), "key", 'x');
+    mpicxx::info info_2;
+    set_longest_value(info_2.get(), "key", 'x');
+
+    // info objects should compare equal
+    EXPECT_TRUE(fast_equal(info_1, info_2));
+    EXPECT_TRUE(fast_equal(info_2, info_1));
+
+    // replace the value of one info object with a value of the same length
+    set_longest_value(info_2.get(), "key", 'y');
+
+    // info objects should not compare equal
+    EXPECT_FALSE(fast_equal(info_1, info_2));
+    EXPECT_FALSE(fast_equal(info_2, info_1));
+}
+
+TEST(NonMemberFunctionTest, NullFastEqual) {
+    // create null info objects
+    mpicxx::info info_null_1(MPI_INFO_NULL, false);
+    mpicxx::info info_null_2(MPI_INFO_NULL, false);
+    mpicxx::info info;
+
+    // two info objects referring to MPI_INFO_NULL compare equal
+    EXPECT_TRUE(fast_equal(info_null_1, info_null_2));
+
+    // an info object referring to MPI_INFO_NULL never compares equal to a valid info object
+    EXPECT_FALSE(fast_equal(info_null_1, info));
+    EXPECT_FALSE(fast_equal(info, info_null_1));
+}
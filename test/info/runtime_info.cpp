@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::runtime_info() cache and the functions reading from it.
+ * @details Testsuite: *RuntimeInfoTest*
+ * | test case name   | test case description                                            |
+ * |:-----------------|:-----------------------------------------------------------------|
+ * | CachedValues     | the cached values match the values queried directly via MPI      |
+ * | FilledOnce       | all calls refer to the same cache                                |
+ * | UniverseSize     | @ref mpicxx::universe_size() reads from the cache                |
+ * | ProcessorName    | @ref mpicxx::processor_name() reads from the cache               |
+ */
+
+#include <mpicxx/info/runtime_info.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+
+TEST(RuntimeInfoTest, CachedValues) {
+    const mpicxx::runtime_info_cache& cache = mpicxx::runtime_info();
+
+    // check the world size and rank
+    int size, rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    EXPECT_EQ(cache.world_size, size);
+    EXPECT_EQ(cache.world_rank, rank);
+
+    // check the MPI version
+    int version, subversion;
+    MPI_Get_version(&version, &subversion);
+    EXPECT_EQ(cache.mpi_version_major, version);
+    EXPECT_EQ(cache.mpi_version_minor, subversion);
+
+    // check the library version
+    char library_version[MPI_MAX_LIBRARY_VERSION_STRING];
+    int resultlen;
+    MPI_Get_library_version(library_version, &resultlen);
+    EXPECT_EQ(cache.mpi_library_version, std::string(library_version, resultlen));
+
+    // check the processor name
+    char name[MPI_MAX_PROCESSOR_NAME];
+    MPI_Get_processor_name(name, &resultlen);
+    EXPECT_EQ(cache.processor_name, std::string(name, resultlen));
+}
+
+TEST(RuntimeInfoTest, FilledOnce) {
+    // repeated calls should return the same object
+    EXPECT_EQ(&mpicxx::runtime_info(), &mpicxx::runtime_info());
+}
+
+TEST(RuntimeInfoTest, UniverseSize) {
+    // query the universe size directly
+    void* ptr;
+    int flag;
+    MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_UNIVERSE_SIZE, &ptr, &flag);
+
+    // the cached value should be the same
+    ASSERT_EQ(mpicxx::universe_size().has_value(), static_cast<bool>(flag));
+    if (static_cast<bool>(flag)) {
+        EXPECT_EQ(mpicxx::universe_size().value(), *reinterpret_cast<int*>(ptr));
+    }
+    EXPECT_EQ(mpicxx::universe_size(), mpicxx::runtime_info().universe_size);
+}
+
+TEST(RuntimeInfoTest, ProcessorName) {
+    // the processor name should be read from the cache
+    EXPECT_EQ(mpicxx::processor_name(), mpicxx::runtime_info().processor_name);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::communication_proxy class and its lock-free @ref mpicxx::detail::mpsc_queue.
+ * @details Testsuite: *StartupTest*
+ * | test case name                   | test case description                                                    |
+ * |:---------------------------------|:-------------------------------------------------------------------------|
+ * | CommunicationProxyQueueOrder     | pop the elements in the order they were pushed                           |
+ * | CommunicationProxyQueueMoveOnly  | push and pop move-only elements                                          |
+ * | CommunicationProxyQueueProducers | push concurrently from multiple threads (per-producer order is retained) |
+ * | CommunicationProxyThreadSupport  | the communication proxy requires MPI_THREAD_FUNNELED                     |
+ * | CommunicationProxyMainThread     | callables submitted by the main thread are executed immediately          |
+ * | CommunicationProxyWorkerThreads  | callables submitted by worker threads are executed by the main thread    |
+ * | CommunicationProxyException      | exceptions are propagated through the future                             |
+ */
+
+#include <mpicxx/startup/communication_proxy.hpp>
+#include <mpicxx/startup/init.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(StartupTest, CommunicationProxyQueueOrder) {
+    mpicxx::detail::mpsc_queue<int> queue;
+    EXPECT_FALSE(queue.pop().has_value());
+
+    for (int i = 0; i < 10; ++i) {
+        queue.push(i);
+    }
+    for (int i = 0; i < 10; ++i) {
+        const std::optional<int> value = queue.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(StartupTest, CommunicationProxyQueueMoveOnly) {
+    mpicxx::detail::mpsc_queue<std::unique_ptr<int>> queue;
+    queue.push(std::make_unique<int>(42));
+    queue.push(std::make_unique<int>(43));
+
+    std::optional<std::unique_ptr<int>> value = queue.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(*value.value(), 42);
+
+    // the remaining element gets destroyed by the queue
+}
+
+TEST(StartupTest, CommunicationProxyQueueProducers) {
+    constexpr int number_of_producers = 4;
+    constexpr int number_of_elements = 1000;
+    mpicxx::detail::mpsc_queue<std::pair<int, int>> queue;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < number_of_producers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < number_of_elements; ++i) {
+                queue.push(std::make_pair(p, i));
+            }
+        });
+    }
+
+    // consume concurrently: the elements of each producer must arrive in order
+    std::vector<int> next(number_of_producers, 0);
+    int popped = 0;
+    while (popped < number_of_producers * number_of_elements) {
+        if (const std::optional<std::pair<int, int>> value = queue.pop()) {
+            EXPECT_EQ(value->second, next[value->first]);
+            ++next[value->first];
+            ++popped;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& t : producers) {
+        t.join();
+    }
+    EXPECT_FALSE(queue.pop().has_value());
+    for (const int n : next) {
+        EXPECT_EQ(n, number_of_elements);
+    }
+}
+
+TEST(StartupTest, CommunicationProxyThreadSupport) {
+    // without at least MPI_THREAD_FUNNELED the communication proxy can't be created
+    if (mpicxx::provided_thread_support() < mpicxx::thread_support::funneled) {
+        EXPECT_THROW(mpicxx::communication_proxy{}, mpicxx::thread_support_not_satisfied);
+    }
+}
+
+TEST(StartupTest, CommunicationProxyMainThread) {
+    // the communication proxy requires at least MPI_THREAD_FUNNELED
+    if (mpicxx::provided_thread_support() < mpicxx::thread_support::funneled) {
+        return;
+    }
+
+    mpicxx::communication_proxy proxy;
+
+    // executed immediately
+    std::future<int> size = proxy.submit([]() { int size; MPI_Comm_size(MPI_COMM_WORLD, &size); return size; });
+    ASSERT_EQ(size.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    int expected_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &expected_size);
+    EXPECT_EQ(size.get(), expected_size);
+}
+
+TEST(StartupTest, CommunicationProxyWorkerThreads) {
+    // the communication proxy requires at least MPI_THREAD_FUNNELED
+    if (mpicxx::provided_thread_support() < mpicxx::thread_support::funneled) {
+        return;
+    }
+
+    mpicxx::communication_proxy proxy;
+    constexpr int number_of_workers = 4;
+    constexpr int number_of_submits = 100;
+
+    std::atomic<int> finished = 0;
+    std::atomic<int> wrong_thread = 0;
+    std::vector<std::thread> workers;
+    for (int w = 0; w < number_of_workers; ++w) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < number_of_submits; ++i) {
+                std::future<bool> is_main = proxy.submit([]() { return mpicxx::is_main_thread(); });
+                if (!is_main.get()) {
+                    ++wrong_thread;
+                }
+            }
+            ++finished;
+        });
+    }
+
+    // the main thread executes the callables until all workers are done
+    const std::size_t executed = proxy.run_until([&]() { return finished == number_of_workers; });
+    for (std::thread& t : workers) {
+        t.join();
+    }
+    EXPECT_EQ(executed, static_cast<std::size_t>(number_of_workers * number_of_submits));
+    EXPECT_EQ(wrong_thread, 0);
+}
+
+TEST(StartupTest, CommunicationProxyException) {
+    // the communication proxy requires at least MPI_THREAD_FUNNELED
+    if (mpicxx::provided_thread_support() < mpicxx::thread_support::funneled) {
+        return;
+    }
+
+    mpicxx::communication_proxy proxy;
+
+    std::future<void> res;
+    std::thread worker([&]() { res = proxy.submit([]() { throw std::runtime_error("failed"); }); });
+    worker.join();
+    EXPECT_EQ(proxy.progress(), 1u);
+    EXPECT_THROW(res.get(), std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::elastic_group class.
+ * @details Testsuite: *StartupTest*
+ * | test case name            | test case description                              |
+ * |:--------------------------|:---------------------------------------------------|
+ * | ElasticGroupConstruct     | create a new group without any workers             |
+ * | ElasticGroupCollective    | use an intracommunicator collective on the group   |
+ * | ElasticGroupMoveConstruct | move construct a group                             |
+ * | ElasticGroupMoveAssign    | move assign a group                                |
+ * | ElasticGroupInvalidGrow   | grow by an illegal number of workers (death test)  |
+ * | ElasticGroupInvalidShrink | release an illegal number of workers (death test)  |
+ * | ElasticGroupJoinNoParent  | join a group without a parent process (death test) |
+ */
+
+#include <mpicxx/startup/elastic_group.hpp>
+#include <mpicxx/startup/single_spawner.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <utility>
+
+TEST(StartupTest, ElasticGroupConstruct) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // create new group containing all processes as parents
+    mpicxx::elastic_group group(mpicxx::single_spawner("a.out", 1));
+    ASSERT_TRUE(group.active());
+    EXPECT_NE(group.communicator(), MPI_COMM_NULL);
+    EXPECT_NE(group.communicator(), MPI_COMM_WORLD);
+    EXPECT_EQ(group.rank(), rank);
+    EXPECT_EQ(group.size(), size);
+    EXPECT_EQ(group.number_of_parents(), size);
+    EXPECT_EQ(group.number_of_workers(), 0);
+    EXPECT_FALSE(group.is_worker());
+}
+
+TEST(StartupTest, ElasticGroupCollective) {
+    mpicxx::elastic_group group(mpicxx::single_spawner("a.out", 1));
+
+    // the group's communicator is an intracommunicator
+    int flag;
+    MPI_Comm_test_inter(group.communicator(), &flag);
+    EXPECT_FALSE(static_cast<bool>(flag));
+
+    int value = group.rank() + 1;
+    int sum;
+    MPI_Allreduce(&value, &sum, 1, MPI_INT, MPI_SUM, group.communicator());
+    EXPECT_EQ(sum, group.size() * (group.size() + 1) / 2);
+}
+
+TEST(StartupTest, ElasticGroupMoveConstruct) {
+    mpicxx::elastic_group group(mpicxx::single_spawner("a.out", 1));
+    const MPI_Comm comm = group.communicator();
+    const int parents = group.number_of_parents();
+
+    // move construct a new group
+    mpicxx::elastic_group moved(std::move(group));
+    EXPECT_EQ(moved.communicator(), comm);
+    EXPECT_EQ(moved.number_of_parents(), parents);
+    EXPECT_TRUE(moved.active());
+    EXPECT_FALSE(moved.is_worker());
+
+    // the moved-from group isn't active anymore
+    EXPECT_FALSE(group.active());
+    EXPECT_EQ(group.communicator(), MPI_COMM_NULL);
+    EXPECT_EQ(group.number_of_parents(), 0);
+}
+
+TEST(StartupTest, ElasticGroupMoveAssign) {
+    mpicxx::elastic_group group(mpicxx::single_spawner("a.out", 1));
+    mpicxx::elastic_group other(mpicxx::single_spawner("b.out", 1));
+    const MPI_Comm comm = group.communicator();
+
+    // move assign group (other's communicator gets freed)
+    other = std::move(group);
+    EXPECT_EQ(other.communicator(), comm);
+    EXPECT_TRUE(other.active());
+
+    // the moved-from group isn't active anymore
+    EXPECT_FALSE(group.active());
+    EXPECT_EQ(group.communicator(), MPI_COMM_NULL);
+}
+
+TEST(StartupDeathTest, ElasticGroupInvalidGrow) {
+    mpicxx::elastic_group group(mpicxx::single_spawner("a.out", 1));
+
+    // try growing by an illegal number of workers
+    ASSERT_DEATH( group.grow(0) , "");
+    ASSERT_DEATH( group.grow(-1) , "");
+}
+
+TEST(StartupDeathTest, ElasticGroupInvalidShrink) {
+    mpicxx::elastic_group group(mpicxx::single_spawner("a.out", 1));
+
+    // try releasing an illegal number of workers (the group doesn't contain any workers)
+    ASSERT_DEATH( group.shrink(0) , "");
+    ASSERT_DEATH( group.shrink(1) , "");
+}
+
+TEST(StartupDeathTest, ElasticGroupJoinNoParent) {
+    // the current process hasn't been spawned
+    ASSERT_DEATH( [[maybe_unused]] const auto group = mpicxx::elastic_group::join() , "");
+}
\ No newline at end of file
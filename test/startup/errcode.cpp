@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::errcode class and the @ref mpicxx::summarize_errcodes() function.
+ * @details Testsuite: *StartupTest*
+ * | test case name            | test case description                                     |
+ * |:--------------------------|:----------------------------------------------------------|
+ * | ErrcodeDefault            | default construct an errcode (MPI_SUCCESS)                |
+ * | ErrcodeValue              | construct an errcode from an MPI error code               |
+ * | ErrcodeMessage            | retrieve the error string of an errcode                   |
+ * | ErrcodeUnset              | check an errcode which hasn't been set by the MPI library |
+ * | ErrcodeComparison         | compare two errcodes                                      |
+ * | ErrcodeToString           | check the conversion of an errcode to a string            |
+ * | SummarizeErrcodesNoErrors | summarize error codes without any errors                  |
+ * | SummarizeErrcodes         | summarize error codes containing multiple distinct errors |
+ */
+
+#include <mpicxx/startup/errcode.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+TEST(StartupTest, ErrcodeDefault) {
+    // a default constructed errcode represents MPI_SUCCESS
+    constexpr mpicxx::errcode err;
+    EXPECT_EQ(err.value(), MPI_SUCCESS);
+    EXPECT_TRUE(err.success());
+    EXPECT_EQ(err.error_class(), MPI_SUCCESS);
+}
+
+TEST(StartupTest, ErrcodeValue) {
+    // construct an errcode from an MPI error code
+    constexpr mpicxx::errcode err(MPI_ERR_SPAWN);
+    EXPECT_EQ(err.value(), MPI_ERR_SPAWN);
+    EXPECT_FALSE(err.success());
+    EXPECT_EQ(err.error_class(), MPI_ERR_SPAWN);
+}
+
+TEST(StartupTest, ErrcodeMessage) {
+    // the error string is the same as the one returned by MPI_Error_string
+    char error_string[MPI_MAX_ERROR_STRING];
+    int resultlen;
+    MPI_Error_string(MPI_ERR_SPAWN, error_string, &resultlen);
+    EXPECT_EQ(mpicxx::errcode(MPI_ERR_SPAWN).message(), std::string(error_string, resultlen));
+}
+
+TEST(StartupTest, ErrcodeUnset) {
+    // the errcode -1 hasn't been set by the MPI library
+    const mpicxx::errcode err(-1);
+    EXPECT_FALSE(err.success());
+    EXPECT_EQ(err.error_class(), -1);
+    EXPECT_EQ(err.message(), std::string("Failed to retrieve error string"));
+}
+
+TEST(StartupTest, ErrcodeComparison) {
+    // compare errcodes by their wrapped MPI error codes
+    const mpicxx::errcode err1(MPI_SUCCESS);
+    const mpicxx::errcode err2(MPI_ERR_SPAWN);
+    EXPECT_EQ(err1, mpicxx::errcode());
+    EXPECT_NE(err1, err2);
+    EXPECT_EQ(err1 < err2, MPI_SUCCESS < MPI_ERR_SPAWN);
+}
+
+TEST(StartupTest, ErrcodeToString) {
+    // the errcode gets printed as its wrapped MPI error code
+    EXPECT_EQ(fmt::format("{}", mpicxx::errcode(MPI_ERR_SPAWN)), std::to_string(MPI_ERR_SPAWN));
+}
+
+TEST(StartupTest, SummarizeErrcodesNoErrors) {
+    // no errors -> empty summary
+    const std::vector<int> errcodes(10, MPI_SUCCESS);
+    EXPECT_TRUE(mpicxx::summarize_errcodes(errcodes).empty());
+    EXPECT_TRUE(mpicxx::summarize_errcodes(std::vector<int>{}).empty());
+}
+
+TEST(StartupTest, SummarizeErrcodes) {
+    const std::vector<int> errcodes = { MPI_SUCCESS, MPI_ERR_SPAWN, MPI_SUCCESS, -1, MPI_ERR_SPAWN, MPI_ERR_SPAWN, -1, MPI_SUCCESS };
+
+    // the distinct errors are ordered by their first occurrence
+    const std::vector<mpicxx::errcode_summary> summary = mpicxx::summarize_errcodes(errcodes);
+    ASSERT_EQ(summary.size(), 2);
+
+    EXPECT_EQ(summary[0].code, mpicxx::errcode(MPI_ERR_SPAWN));
+    EXPECT_EQ(summary[0].count, 3);
+    EXPECT_EQ(summary[0].first_index, 1);
+    EXPECT_EQ(summary[0].message, mpicxx::errcode(MPI_ERR_SPAWN).message());
+
+    EXPECT_EQ(summary[1].code, mpicxx::errcode(-1));
+    EXPECT_EQ(summary[1].count, 2);
+    EXPECT_EQ(summary[1].first_index, 3);
+    EXPECT_EQ(summary[1].message, std::string("Failed to retrieve error string"));
+}
\ No newline at end of file
@@ -6,18 +6,27 @@
  *
  * @brief Test cases for the finalization functions.
  * @details Testsuite: *StartupTest*
- * | test case name             | test case description                              |
- * |:---------------------------|:---------------------------------------------------|
- * | IsFinalized                | check that no [*MPI_Finalize()*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) has been called yet |
- * | Abort                      | abort the given communicator group (death test)    |
- * | AtfinalizeNullptr          | nullptr as atfinalize callback (death test)        |
- * | AtfinalizeTooManyCallbacks | nullptr as atfinalize callback (death test)        |
+ * | test case name              | test case description                                   |
+ * |:----------------------------|:--------------------------------------------------------|
+ * | IsFinalized                 | check that no [*MPI_Finalize()*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) has been called yet |
+ * | Abort                       | abort the given communicator group (death test)         |
+ * | AtfinalizeNullptr           | nullptr as atfinalize callback (death test)             |
+ * | AtfinalizeEmptyFunction     | empty std::function as atfinalize callback (death test) |
+ * | AtfinalizeManyCallbacks     | register an arbitrary number of atfinalize callbacks    |
+ * | AtfinalizeRegistryOrder     | invoke the callbacks ordered by their priority          |
+ * | AtfinalizeRegistryMoveOnly  | register a move-only callable with captured state       |
+ * | AtfinalizeRegistryReentrant | register a callback while invoking the callbacks        |
  */
 
 #include <gtest/gtest.h>
 
 #include <mpicxx/startup/finalize.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
 TEST(StartupTest, IsFinalized) {
     // MPI shouldn't be finalized yet
     EXPECT_FALSE(mpicxx::finalized());
@@ -33,13 +42,80 @@ TEST(StartupDeathTest, AtfinalizeNullptr) {
     EXPECT_DEATH( mpicxx::atfinalize(nullptr) , "");
 }
 
-TEST(StartupDeathTest, AtfinalizeTooManyCallbacks) {
-    // register MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS number of callback functions
-    const auto callback = [](){};
-    for (int i = 0; i < MPICXX_MAX_NUMBER_OF_ATFINALIZE_CALLBACKS; ++i) {
-        mpicxx::atfinalize(callback);
+TEST(StartupDeathTest, AtfinalizeEmptyFunction) {
+    // try to register an empty std::function as callback function
+    EXPECT_DEATH( mpicxx::atfinalize(std::function<void()>{}) , "");
+}
+
+TEST(StartupTest, AtfinalizeManyCallbacks) {
+    // register more callback functions than the old fixed size limit
+    mpicxx::detail::atfinalize_registry registry;
+    int counter = 0;
+    for (int i = 0; i < 100; ++i) {
+        registry.add([i, &counter]() { counter += i; }, 0);
     }
+    registry.add(std::function<void()>([&counter]() { counter = -counter; }), 10);
+    EXPECT_EQ(registry.size(), 101);
+
+    // invoke all callbacks (the one with the higher priority first)
+    registry.invoke();
+    EXPECT_EQ(counter, 4950);
+    EXPECT_EQ(registry.size(), 0);
+
+    // the public interface registers the keyval calling the global registry (the callbacks are invoked during MPI_Finalize)
+    const std::size_t size = mpicxx::detail::atfinalize_callbacks.size();
+    EXPECT_EQ(mpicxx::atfinalize(+[]() { }), 0);
+    mpicxx::atfinalize([]() { }, 10);
+    EXPECT_EQ(mpicxx::detail::atfinalize_callbacks.size(), size + 2);
+    EXPECT_TRUE(mpicxx::detail::atfinalize_registered);
+}
+
+TEST(StartupTest, AtfinalizeRegistryOrder) {
+    mpicxx::detail::atfinalize_registry registry;
+    std::vector<int> order;
+
+    // add callbacks with different priorities
+    registry.add([&order]() { order.push_back(0); }, 0);
+    registry.add([&order]() { order.push_back(1); }, 5);
+    registry.add([&order]() { order.push_back(2); }, 0);
+    registry.add([&order]() { order.push_back(3); }, -5);
+    registry.add([&order]() { order.push_back(4); }, 5);
+    EXPECT_EQ(registry.size(), 5);
+
+    // descending priority, same priority in reverse order of registration
+    registry.invoke();
+    EXPECT_EQ(order, (std::vector<int>{ 4, 1, 2, 0, 3 }));
+    EXPECT_EQ(registry.size(), 0);
+
+    // invoking an empty registry does nothing
+    registry.invoke();
+    EXPECT_EQ(order.size(), 5);
+}
+
+TEST(StartupTest, AtfinalizeRegistryMoveOnly) {
+    mpicxx::detail::atfinalize_registry registry;
+    int value = 0;
+
+    // add a move-only callable with captured state
+    auto ptr = std::make_unique<int>(42);
+    registry.add([ptr = std::move(ptr), &value]() { value = *ptr; }, 0);
+
+    registry.invoke();
+    EXPECT_EQ(value, 42);
+}
+
+TEST(StartupTest, AtfinalizeRegistryReentrant) {
+    mpicxx::detail::atfinalize_registry registry;
+    std::vector<int> order;
+
+    // a callback registering another callback while being invoked
+    registry.add([&registry, &order]() {
+        order.push_back(0);
+        registry.add([&order]() { order.push_back(1); }, 100);
+    }, 0);
 
-    // try register one more callback function
-    EXPECT_DEATH( mpicxx::atfinalize(callback) , "");
+    // the newly added callback gets invoked afterwards
+    registry.invoke();
+    EXPECT_EQ(order, (std::vector<int>{ 0, 1 }));
+    EXPECT_EQ(registry.size(), 0);
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the stitching of a hierarchical spawn (@ref mpicxx::multiple_spawner::spawn_hierarchical(const int) and
+ *        @ref mpicxx::join_hierarchical_spawn()).
+ * @details Testsuite: *StartupTest*
+ * | test case name                | test case description                                             |
+ * |:------------------------------|:------------------------------------------------------------------|
+ * | HierarchicalSpawnStitching    | stitch the groups of all processes into one intercommunicator     |
+ * | HierarchicalSpawnInvalidRoots | spawn hierarchically with an illegal number of roots (death test) |
+ * | JoinHierarchicalSpawnNoParent | join a hierarchical spawn without a parent process (death test)   |
+ */
+
+#include <mpicxx/startup/hierarchical_spawn.hpp>
+#include <mpicxx/startup/multiple_spawner.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+TEST(StartupTest, HierarchicalSpawnStitching) {
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // every process leads its own group, the processes with an odd rank act as "spawned" processes
+    MPI_Comm group;
+    MPI_Comm_dup(MPI_COMM_SELF, &group);
+    mpicxx::detail::hierarchical_spawn_lead(group, rank, size, MPI_COMM_WORLD);
+
+    // all processes are stitched together in rank order
+    int group_rank, group_size;
+    MPI_Comm_rank(group, &group_rank);
+    MPI_Comm_size(group, &group_size);
+    EXPECT_EQ(group_rank, rank);
+    EXPECT_EQ(group_size, size);
+
+    // split into the "spawning" and "spawned" processes
+    const bool is_child = rank % 2 == 1;
+    auto [intercomm, local] = mpicxx::detail::hierarchical_spawn_split(group, is_child);
+    EXPECT_EQ(group, MPI_COMM_NULL);
+
+    int flag;
+    MPI_Comm_test_inter(intercomm, &flag);
+    EXPECT_TRUE(static_cast<bool>(flag));
+
+    int local_rank, local_size, remote_size;
+    MPI_Comm_rank(intercomm, &local_rank);
+    MPI_Comm_size(intercomm, &local_size);
+    MPI_Comm_remote_size(intercomm, &remote_size);
+    EXPECT_EQ(local_rank, rank / 2);
+    EXPECT_EQ(local_size, is_child ? size / 2 : (size + 1) / 2);
+    EXPECT_EQ(remote_size, size - local_size);
+
+    int world_size;
+    MPI_Comm_size(local, &world_size);
+    EXPECT_EQ(world_size, local_size);
+
+    MPI_Comm_free(&intercomm);
+    MPI_Comm_free(&local);
+}
+
+TEST(StartupDeathTest, HierarchicalSpawnInvalidRoots) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "a.out", 1 }, { "b.out", 1 } });
+
+    // try spawning with an illegal number of roots
+    ASSERT_DEATH( ms.spawn_hierarchical(0) , "");
+    ASSERT_DEATH( ms.spawn_hierarchical(3) , "");
+}
+
+TEST(StartupDeathTest, JoinHierarchicalSpawnNoParent) {
+    // the current process hasn't been spawned
+    ASSERT_DEATH( [[maybe_unused]] const auto context = mpicxx::join_hierarchical_spawn() , "");
+}
\ No newline at end of file
@@ -6,11 +6,15 @@
  *
  * @brief Test cases for the initialization functions.
  * @details Testsuite: *StartupTest*
- * | test case name | test case description                                                                                      |
- * |:---------------|:-----------------------------------------------------------------------------------------------------------|
- * | IsInitialized  | check that [*MPI_Init()*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) has been called |
- * | IsActive       | check that the MPI environment is currently active                                                         |
- * | IsMainThread   | check whether this thread is the main thread                                                               |
+ * | test case name              | test case description                                                                                      |
+ * |:----------------------------|:-----------------------------------------------------------------------------------------------------------|
+ * | IsInitialized               | check that [*MPI_Init()*](https://www.mpi-forum.org/docs/mpi-3.1/mpi31-report/node225.htm) has been called |
+ * | IsActive                    | check that the MPI environment is currently active                                                         |
+ * | IsMainThread                | check whether this thread is the main thread                                                               |
+ * | RequireThreadSupport        | check whether the provided level of thread support is correctly validated                                  |
+ * | EnsureInitialized           | nothing happens if no initialization has been deferred                                                     |
+ * | EnsureInitializedDeferred   | a deferred initialization isn't performed if the MPI environment has already been initialized              |
+ * | DeferInitAlreadyInitialized | defer the initialization of an already initialized MPI environment (death test)                            |
  */
 
 #include <mpicxx/startup/init.hpp>
@@ -30,4 +34,46 @@ TEST(StartupTest, IsActive) {
 TEST(StartupTest, IsMainThread) {
     // check whether this thread is the main thread -> true since only one thread is spawned
     EXPECT_TRUE(mpicxx::is_main_thread());
+}
+
+TEST(StartupTest, RequireThreadSupport) {
+    // the lowest level of thread support is always satisfied
+    EXPECT_NO_THROW(mpicxx::require_thread_support(mpicxx::thread_support::single));
+    // the provided level of thread support is always satisfied
+    EXPECT_NO_THROW(mpicxx::require_thread_support(mpicxx::provided_thread_support()));
+
+    // a higher level of thread support than provided isn't satisfied
+    if (mpicxx::provided_thread_support() != mpicxx::thread_support::multiple) {
+        EXPECT_THROW(mpicxx::require_thread_support(mpicxx::thread_support::multiple), mpicxx::thread_support_not_satisfied);
+    }
+}
+
+TEST(StartupTest, EnsureInitialized) {
+    // no initialization has been deferred -> nothing happens
+    ASSERT_FALSE(mpicxx::detail::deferred_init.has_value());
+    EXPECT_NO_THROW(mpicxx::ensure_initialized());
+    EXPECT_FALSE(mpicxx::detail::deferred_init_done.load());
+    EXPECT_TRUE(mpicxx::initialized());
+}
+
+TEST(StartupTest, EnsureInitializedDeferred) {
+    // simulate a deferred initialization
+    mpicxx::detail::deferred_init = mpicxx::detail::deferred_init_parameters{};
+
+    // the MPI environment has already been initialized -> must not be initialized again
+    EXPECT_NO_THROW(mpicxx::ensure_initialized());
+    EXPECT_TRUE(mpicxx::detail::deferred_init_done.load());
+    // the fast path must be used from now on
+    EXPECT_NO_THROW(mpicxx::ensure_initialized());
+    EXPECT_TRUE(mpicxx::active());
+
+    // reset the deferred initialization
+    mpicxx::detail::deferred_init.reset();
+    mpicxx::detail::deferred_init_done.store(false);
+}
+
+TEST(StartupDeathTest, DeferInitAlreadyInitialized) {
+    // the MPI environment has already been initialized
+    ASSERT_DEATH( mpicxx::defer_init() , "");
+    ASSERT_DEATH( mpicxx::defer_init(mpicxx::thread_support::single) , "");
 }
\ No newline at end of file
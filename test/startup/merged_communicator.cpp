@@ -0,0 +1,130 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::merged_communicator class.
+ * @details Testsuite: *StartupTest*
+ * | test case name                  | test case description                                          |
+ * |:--------------------------------|:---------------------------------------------------------------|
+ * | MergedCommunicatorLow           | merge with the lower group ordered first                       |
+ * | MergedCommunicatorHigh          | merge with the lower group ordered last                        |
+ * | MergedCommunicatorCollective    | use an intracommunicator collective on the merged communicator |
+ * | MergedCommunicatorMoveConstruct | move construct a merged communicator                           |
+ * | MergedCommunicatorMoveAssign    | move assign a merged communicator                              |
+ * | MergedCommunicatorRelease       | release the ownership of the underlying communicator           |
+ * | MergeWithParentNoParent         | merge with the parent processes without a parent (death test)  |
+ */
+
+#include <mpicxx/startup/merged_communicator.hpp>
+#include <mpicxx/startup/spawn_result.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <utility>
+
+namespace {
+    // create an intercommunicator between the even and odd ranks of MPI_COMM_WORLD
+    class intercomm_guard {
+    public:
+        intercomm_guard() {
+            int rank;
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            color = rank % 2;
+            MPI_Comm_split(MPI_COMM_WORLD, color, rank, &local);
+            MPI_Intercomm_create(local, 0, MPI_COMM_WORLD, 1 - color, 0, &inter);
+        }
+        ~intercomm_guard() {
+            MPI_Comm_free(&inter);
+            MPI_Comm_free(&local);
+        }
+
+        int color;
+        MPI_Comm local;
+        MPI_Comm inter;
+    };
+}
+
+
+TEST(StartupTest, MergedCommunicatorLow) {
+    intercomm_guard guard;
+
+    // the group of rank 0 is ordered first
+    mpicxx::merged_communicator merged(guard.inter, guard.color == 1);
+    ASSERT_NE(merged.get(), MPI_COMM_NULL);
+    EXPECT_EQ(merged.size(), 2);
+    EXPECT_EQ(merged.rank(), guard.color);
+}
+
+TEST(StartupTest, MergedCommunicatorHigh) {
+    intercomm_guard guard;
+
+    // the group of rank 0 is ordered last
+    mpicxx::merged_communicator merged(guard.inter, guard.color == 0);
+    ASSERT_NE(merged.get(), MPI_COMM_NULL);
+    EXPECT_EQ(merged.size(), 2);
+    EXPECT_EQ(merged.rank(), 1 - guard.color);
+}
+
+TEST(StartupTest, MergedCommunicatorCollective) {
+    intercomm_guard guard;
+    mpicxx::merged_communicator merged(guard.inter, guard.color == 1);
+
+    // the merged communicator is an intracommunicator
+    int flag;
+    MPI_Comm_test_inter(merged.get(), &flag);
+    EXPECT_FALSE(static_cast<bool>(flag));
+
+    int value = merged.rank() + 1;
+    int sum = 0;
+    MPI_Allreduce(&value, &sum, 1, MPI_INT, MPI_SUM, merged.get());
+    EXPECT_EQ(sum, 3);
+}
+
+TEST(StartupTest, MergedCommunicatorMoveConstruct) {
+    intercomm_guard guard;
+    mpicxx::merged_communicator merged(guard.inter, guard.color == 1);
+    const MPI_Comm comm = merged.get();
+
+    // move construct the merged communicator
+    mpicxx::merged_communicator moved(std::move(merged));
+    EXPECT_EQ(moved.get(), comm);
+    EXPECT_EQ(moved.size(), 2);
+    // the moved-from object doesn't own a communicator anymore
+    EXPECT_EQ(merged.get(), MPI_COMM_NULL);
+}
+
+TEST(StartupTest, MergedCommunicatorMoveAssign) {
+    intercomm_guard guard;
+    mpicxx::merged_communicator merged_1(guard.inter, guard.color == 1);
+    mpicxx::merged_communicator merged_2(guard.inter, guard.color == 0);
+    const MPI_Comm comm = merged_1.get();
+
+    // move assign the merged communicator (frees the communicator owned by merged_2)
+    merged_2 = std::move(merged_1);
+    EXPECT_EQ(merged_2.get(), comm);
+    EXPECT_EQ(merged_2.rank(), guard.color);
+    // the moved-from object doesn't own a communicator anymore
+    EXPECT_EQ(merged_1.get(), MPI_COMM_NULL);
+}
+
+TEST(StartupTest, MergedCommunicatorRelease) {
+    intercomm_guard guard;
+    mpicxx::merged_communicator merged(guard.inter, guard.color == 1);
+    const MPI_Comm comm = merged.get();
+
+    // release the ownership
+    MPI_Comm released = merged.release();
+    EXPECT_EQ(released, comm);
+    EXPECT_EQ(merged.get(), MPI_COMM_NULL);
+
+    // the caller is responsible for freeing the communicator
+    MPI_Comm_free(&released);
+}
+
+TEST(StartupDeathTest, MergeWithParentNoParent) {
+    // the current process hasn't been spawned
+    ASSERT_DEATH( [[maybe_unused]] const auto merged = mpicxx::merge_with_parent() , "");
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::multiple_spawner::freeze() const member function provided by the
+ *        @ref mpicxx::multiple_spawner class.
+ * @details Testsuite: *MultipleSpawnerTest*
+ * | test case name        | test case description                                                       |
+ * |:----------------------|:----------------------------------------------------------------------------|
+ * | FreezeCommands        | the executable names are laid out in the arena                              |
+ * | FreezeArgvs           | the command line arguments are laid out in nullptr-terminated lists         |
+ * | FreezeNoArgvs         | MPI_ARGVS_NULL is used if no command line arguments are given               |
+ * | FreezeOptions         | maxprocs, spawn info, root and communicator are frozen                      |
+ * | FreezeIsIndependent   | later changes to the multiple_spawner aren't reflected                      |
+ * | FreezeMove            | the pointer tables remain valid after moving the prepared_spawn object      |
+ */
+
+#include <mpicxx/startup/multiple_spawner.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <string>
+#include <utility>
+
+TEST(MultipleSpawnerTest, FreezeCommands) {
+    // create new multiple_spawner object and freeze it
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    const mpicxx::prepared_spawn ps = ms.freeze();
+
+    // check the executable names
+    ASSERT_EQ(ps.size(), 2);
+    EXPECT_STREQ(ps.commands()[0], "foo");
+    EXPECT_STREQ(ps.commands()[1], "bar");
+
+    // the executable names are stored contiguously
+    EXPECT_EQ(ps.commands()[0] + 4, ps.commands()[1]);
+}
+
+TEST(MultipleSpawnerTest, FreezeArgvs) {
+    // create new multiple_spawner object with command line arguments and freeze it
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 }, { "baz", 1 } });
+    ms.add_argv_at(0, "-a", 42);
+    ms.add_argv_at(2, "--file", "path");
+    const mpicxx::prepared_spawn ps = ms.freeze();
+
+    // check the command line arguments
+    char** const* argvs = ps.argvs();
+    ASSERT_NE(argvs, MPI_ARGVS_NULL);
+    EXPECT_STREQ(argvs[0][0], "-a");
+    EXPECT_STREQ(argvs[0][1], "42");
+    EXPECT_EQ(argvs[0][2], nullptr);
+    EXPECT_EQ(argvs[1][0], nullptr);
+    EXPECT_STREQ(argvs[2][0], "--file");
+    EXPECT_STREQ(argvs[2][1], "path");
+    EXPECT_EQ(argvs[2][2], nullptr);
+}
+
+TEST(MultipleSpawnerTest, FreezeNoArgvs) {
+    // create new multiple_spawner object without command line arguments and freeze it
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    const mpicxx::prepared_spawn ps = ms.freeze();
+
+    // MPI_ARGVS_NULL should be used
+    EXPECT_EQ(ps.argvs(), MPI_ARGVS_NULL);
+}
+
+TEST(MultipleSpawnerTest, FreezeOptions) {
+    // create new multiple_spawner object and set options
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 2 } });
+    mpicxx::info info = { { "key", "value" } };
+    ms.set_spawn_info_at(1, info);
+    ms.set_root(1);
+    ms.set_communicator(MPI_COMM_WORLD);
+    const mpicxx::prepared_spawn ps = ms.freeze();
+
+    // check the frozen options
+    EXPECT_EQ(ps.maxprocs(), ms.maxprocs());
+    EXPECT_EQ(ps.total_maxprocs(), 3);
+    ASSERT_EQ(ps.spawn_info().size(), 2);
+    EXPECT_EQ(ps.spawn_info()[0], mpicxx::info::null);
+    EXPECT_EQ(ps.spawn_info()[1], info);
+    EXPECT_EQ(ps.root(), 1);
+    EXPECT_EQ(ps.communicator(), MPI_COMM_WORLD);
+}
+
+TEST(MultipleSpawnerTest, FreezeIsIndependent) {
+    // create new multiple_spawner object and freeze it
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    ms.add_argv_at(0, "-a");
+    const mpicxx::prepared_spawn ps = ms.freeze();
+
+    // change the multiple_spawner object
+    ms.set_command_at(0, "baz");
+    ms.remove_argv();
+    ms.set_maxprocs_at(1, 2);
+
+    // the prepared_spawn object should be unchanged
+    EXPECT_STREQ(ps.commands()[0], "foo");
+    ASSERT_NE(ps.argvs(), MPI_ARGVS_NULL);
+    EXPECT_STREQ(ps.argvs()[0][0], "-a");
+    EXPECT_EQ(ps.total_maxprocs(), 2);
+}
+
+TEST(MultipleSpawnerTest, FreezeMove) {
+    // create new multiple_spawner object and freeze it
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    ms.add_argv_at(1, "-b");
+    mpicxx::prepared_spawn ps = ms.freeze();
+    char* const* commands = ps.commands();
+    char** const* argvs = ps.argvs();
+
+    // move the prepared_spawn object
+    mpicxx::prepared_spawn moved(std::move(ps));
+
+    // the pointer tables should be the same
+    EXPECT_EQ(moved.commands(), commands);
+    EXPECT_EQ(moved.argvs(), argvs);
+    EXPECT_STREQ(moved.commands()[1], "bar");
+    EXPECT_STREQ(moved.argvs()[1][0], "-b");
+}
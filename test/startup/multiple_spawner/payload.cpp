@@ -0,0 +1,170 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::multiple_spawner::set_payload_at(const std::size_t, std::span<const std::byte>),
+ *        @ref mpicxx::multiple_spawner::remove_payload_at(const std::size_t), @ref mpicxx::multiple_spawner::payload() const and
+ *        @ref mpicxx::multiple_spawner::payload_at(const std::size_t) const member functions provided by the
+ *        @ref mpicxx::multiple_spawner class.
+ * @details Testsuite: *MultipleSpawnerTest*
+ * | test case name                | test case description                           |
+ * |:------------------------------|:------------------------------------------------|
+ * | SetIthPayload                 | set the i-th payload                            |
+ * | SetIthPayloadInvalidIndex     | illegal index                                   |
+ * | SetIthPayloadTooLarge         | payload size not representable by an int        |
+ * | RemoveIthPayload              | remove the i-th payload                         |
+ * | RemoveIthPayloadInvalidIndex  | illegal index                                   |
+ * | GetPayload                    | get all payloads                                |
+ * | GetIthPayloadInvalidIndex     | illegal index                                   |
+ * | PayloadFromSpawnerConstructor | take over the payloads of the passed spawners   |
+ * | PayloadFreeze                 | the payloads are taken over by the frozen spawn |
+ */
+
+#include <mpicxx/startup/multiple_spawner.hpp>
+#include <mpicxx/startup/single_spawner.hpp>
+#include <test_utility.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(MultipleSpawnerTest, SetIthPayload) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+
+    // set i-th payload
+    const std::vector<std::byte> payload = { std::byte{ 1 }, std::byte{ 2 } };
+    ms.set_payload_at(1, payload);
+
+    // check if payloads were set correctly
+    EXPECT_FALSE(ms.payload_at(0).has_value());
+    ASSERT_TRUE(ms.payload_at(1).has_value());
+    EXPECT_EQ(ms.payload_at(1).value(), payload);
+}
+
+TEST(MultipleSpawnerTest, SetIthPayloadInvalidIndex) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    const std::vector<std::byte> payload = { std::byte{ 1 } };
+
+    // try setting i-th payload
+    EXPECT_THROW_WHAT(
+            ms.set_payload_at(2, payload),
+            std::out_of_range,
+            "multiple_spawner::set_payload_at(const std::size_t, std::span<const std::byte>) range check: i (which is 2) >= this->size() (which is 2)");
+
+    std::string expected_msg =
+            fmt::format("multiple_spawner::set_payload_at(const std::size_t, std::span<const std::byte>) range check: "
+                        "i (which is {}) >= this->size() (which is 2)", static_cast<std::size_t>(-1));
+    EXPECT_THROW_WHAT(
+            ms.set_payload_at(-1, payload),
+            std::out_of_range,
+            expected_msg);
+}
+
+TEST(MultipleSpawnerTest, SetIthPayloadTooLarge) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+
+    // a payload whose size can't be represented by an int (never accessed)
+    const std::byte data{ 1 };
+    const std::size_t size = static_cast<std::size_t>(std::numeric_limits<int>::max()) + 1;
+    const std::span<const std::byte> payload(&data, size);
+
+    // try setting i-th payload
+    EXPECT_THROW_WHAT(
+            ms.set_payload_at(0, payload),
+            std::length_error,
+            fmt::format("The payload size (which is {}) is greater than the maximum possible size (which is {})!",
+                    size, std::numeric_limits<int>::max()));
+    EXPECT_FALSE(ms.payload_at(0).has_value());
+}
+
+TEST(MultipleSpawnerTest, RemoveIthPayload) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    ms.set_payload_at(0, std::vector<std::byte>{ std::byte{ 1 } });
+    ms.set_payload_at(1, std::vector<std::byte>{ std::byte{ 2 } });
+
+    // remove i-th payload
+    ms.remove_payload_at(0);
+
+    // check if the payloads were removed correctly
+    EXPECT_FALSE(ms.payload_at(0).has_value());
+    EXPECT_TRUE(ms.payload_at(1).has_value());
+}
+
+TEST(MultipleSpawnerTest, RemoveIthPayloadInvalidIndex) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+
+    // try removing i-th payload
+    EXPECT_THROW_WHAT(
+            ms.remove_payload_at(2),
+            std::out_of_range,
+            "multiple_spawner::remove_payload_at(const std::size_t) range check: i (which is 2) >= this->size() (which is 2)");
+}
+
+TEST(MultipleSpawnerTest, GetPayload) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+
+    // check getter
+    ASSERT_EQ(ms.payload().size(), 2);
+    EXPECT_FALSE(ms.payload()[0].has_value());
+    EXPECT_FALSE(ms.payload()[1].has_value());
+}
+
+TEST(MultipleSpawnerTest, GetIthPayloadInvalidIndex) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+
+    // try getting i-th payload
+    [[maybe_unused]] std::optional<std::vector<std::byte>> payload;
+    EXPECT_THROW_WHAT(
+            payload = ms.payload_at(2),
+            std::out_of_range,
+            "multiple_spawner::payload_at(const std::size_t) range check: i (which is 2) >= this->size() (which is 2)");
+}
+
+TEST(MultipleSpawnerTest, PayloadFromSpawnerConstructor) {
+    // create new single_spawner objects
+    mpicxx::single_spawner ss1("foo", 1);
+    mpicxx::single_spawner ss2("bar", 1);
+    const std::vector<std::byte> payload = { std::byte{ 3 } };
+    ss2.set_payload(payload);
+
+    // create new multiple_spawner object from the single_spawner objects
+    mpicxx::multiple_spawner ms(ss1, ss2);
+
+    // check if the payloads were taken over
+    EXPECT_FALSE(ms.payload_at(0).has_value());
+    ASSERT_TRUE(ms.payload_at(1).has_value());
+    EXPECT_EQ(ms.payload_at(1).value(), payload);
+}
+
+TEST(MultipleSpawnerTest, PayloadFreeze) {
+    // create new multiple_spawner object
+    mpicxx::multiple_spawner ms({ { "foo", 1 }, { "bar", 1 } });
+    const std::vector<std::byte> payload = { std::byte{ 4 }, std::byte{ 5 } };
+    ms.set_payload_at(0, payload);
+
+    // freeze the spawn options
+    const mpicxx::prepared_spawn ps = ms.freeze();
+
+    // later changes aren't reflected in the frozen spawn
+    ms.remove_payload_at(0);
+    ASSERT_EQ(ps.payload().size(), 2);
+    ASSERT_TRUE(ps.payload()[0].has_value());
+    EXPECT_EQ(ps.payload()[0].value(), payload);
+    EXPECT_FALSE(ps.payload()[1].has_value());
+}
\ No newline at end of file
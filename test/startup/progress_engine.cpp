@@ -0,0 +1,120 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::progress_engine class.
+ * @details Testsuite: *StartupTest*
+ * | test case name                    | test case description                                              |
+ * |:----------------------------------|:-------------------------------------------------------------------|
+ * | ProgressEngineDefaultConfig       | check the default configuration                                    |
+ * | ProgressEngineThreadSupport       | the progress engine requires MPI_THREAD_MULTIPLE                   |
+ * | ProgressEngineGlobal              | no global progress engine is started if not requested              |
+ * | ProgressEngineRegisterRequest     | complete registered requests in the background                     |
+ * | ProgressEngineBackoff             | idle iterations are counted and probing can be disabled            |
+ * | ProgressEngineRegisterNullRequest | register MPI_REQUEST_NULL (death test)                             |
+ * | ProgressEngineIllegalConfig       | start a progress engine with an illegal configuration (death test) |
+ */
+
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/progress_engine.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+TEST(StartupTest, ProgressEngineDefaultConfig) {
+    const mpicxx::progress_engine_config config;
+    EXPECT_EQ(config.polling_interval, std::chrono::microseconds(10));
+    EXPECT_EQ(config.max_backoff, std::chrono::microseconds(1000));
+    EXPECT_EQ(config.backoff_factor, 2.0);
+    EXPECT_TRUE(config.probe);
+    EXPECT_EQ(config.probe_communicator, MPI_COMM_WORLD);
+    EXPECT_FALSE(config.core.has_value());
+}
+
+TEST(StartupTest, ProgressEngineThreadSupport) {
+    // without MPI_THREAD_MULTIPLE the progress engine can't be started
+    if (mpicxx::provided_thread_support() != mpicxx::thread_support::multiple) {
+        EXPECT_THROW(mpicxx::progress_engine{}, mpicxx::thread_support_not_satisfied);
+    }
+}
+
+TEST(StartupTest, ProgressEngineGlobal) {
+    // the global progress engine hasn't been requested
+    EXPECT_EQ(mpicxx::progress_engine::global(), nullptr);
+}
+
+TEST(StartupTest, ProgressEngineRegisterRequest) {
+    // the progress engine requires MPI_THREAD_MULTIPLE
+    if (mpicxx::provided_thread_support() != mpicxx::thread_support::multiple) {
+        return;
+    }
+
+    mpicxx::progress_engine engine;
+
+    // send a message to itself
+    std::vector<int> send(1024, 42), recv(1024, 0);
+    MPI_Request requests[2];
+    MPI_Irecv(recv.data(), static_cast<int>(recv.size()), MPI_INT, 0, 3, MPI_COMM_SELF, &requests[0]);
+    MPI_Isend(send.data(), static_cast<int>(send.size()), MPI_INT, 0, 3, MPI_COMM_SELF, &requests[1]);
+    std::future<MPI_Status> received = engine.register_request(requests[0]);
+    std::future<MPI_Status> sent = engine.register_request(requests[1]);
+
+    // the requests are completed by the progress thread
+    const MPI_Status status = received.get();
+    sent.wait();
+    EXPECT_EQ(status.MPI_TAG, 3);
+    EXPECT_EQ(recv, send);
+
+    const mpicxx::progress_engine_statistics stats = engine.statistics();
+    EXPECT_EQ(stats.completed_requests, 2u);
+    EXPECT_EQ(stats.pending_requests, 0u);
+    EXPECT_GE(stats.iterations, 1u);
+    EXPECT_GE(stats.probes, 1u);
+    EXPECT_FALSE(engine.pinned());
+}
+
+TEST(StartupTest, ProgressEngineBackoff) {
+    // the progress engine requires MPI_THREAD_MULTIPLE
+    if (mpicxx::provided_thread_support() != mpicxx::thread_support::multiple) {
+        return;
+    }
+
+    mpicxx::progress_engine_config config;
+    config.polling_interval = std::chrono::microseconds(0);
+    config.max_backoff = std::chrono::microseconds(100);
+    config.probe = false;
+    mpicxx::progress_engine engine(config);
+
+    // without any registered request all iterations are idle
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const mpicxx::progress_engine_statistics stats = engine.statistics();
+    EXPECT_GE(stats.iterations, 1u);
+    EXPECT_GE(stats.idle_iterations, 1u);
+    EXPECT_EQ(stats.completed_requests, 0u);
+    EXPECT_EQ(stats.probes, 0u);
+}
+
+TEST(StartupDeathTest, ProgressEngineRegisterNullRequest) {
+    // the progress engine requires MPI_THREAD_MULTIPLE
+    if (mpicxx::provided_thread_support() != mpicxx::thread_support::multiple) {
+        return;
+    }
+
+    mpicxx::progress_engine engine;
+    // register MPI_REQUEST_NULL
+    ASSERT_DEATH( [[maybe_unused]] auto res = engine.register_request(MPI_REQUEST_NULL) , "");
+}
+
+TEST(StartupDeathTest, ProgressEngineIllegalConfig) {
+    mpicxx::progress_engine_config config;
+    config.backoff_factor = 0.5;
+    // start a progress engine with an illegal backoff factor
+    ASSERT_DEATH( mpicxx::progress_engine{ config } , "");
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::single_spawner::set_payload(std::span<const std::byte>),
+ *        @ref mpicxx::single_spawner::remove_payload() and @ref mpicxx::single_spawner::payload() const member functions provided by
+ *        the @ref mpicxx::single_spawner class and the @ref mpicxx::receive_payload() function.
+ * @details Testsuite: *SingleSpawnerTest*
+ * | test case name         | test case description                                   |
+ * |:-----------------------|:--------------------------------------------------------|
+ * | SetPayload             | set a new payload                                       |
+ * | SetEmptyPayload        | set an empty payload                                    |
+ * | SetPayloadTooLarge     | payload size not representable by an int                |
+ * | RemovePayload          | remove the current payload                              |
+ * | GetPayload             | get the current payload                                 |
+ * | ReceivePayloadNoParent | receive a payload without a parent process (death test) |
+ */
+
+#include <mpicxx/startup/single_spawner.hpp>
+#include <mpicxx/startup/spawn_payload.hpp>
+#include <test_utility.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+TEST(SingleSpawnerTest, SetPayload) {
+    // create new single_spawner object
+    mpicxx::single_spawner ss("a.out", 1);
+
+    // set a new payload
+    const std::vector<std::byte> payload = { std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+    ss.set_payload(payload);
+
+    // check whether the payload has been set (as a copy)
+    ASSERT_TRUE(ss.payload().has_value());
+    EXPECT_EQ(ss.payload().value(), payload);
+    EXPECT_NE(ss.payload()->data(), payload.data());
+
+    // replace the payload
+    const std::vector<std::byte> new_payload = { std::byte{ 4 } };
+    ss.set_payload(new_payload);
+    ASSERT_TRUE(ss.payload().has_value());
+    EXPECT_EQ(ss.payload().value(), new_payload);
+}
+
+TEST(SingleSpawnerTest, SetEmptyPayload) {
+    // create new single_spawner object
+    mpicxx::single_spawner ss("a.out", 1);
+
+    // an empty payload is still handed off to the spawned processes
+    ss.set_payload(std::vector<std::byte>{});
+    ASSERT_TRUE(ss.payload().has_value());
+    EXPECT_TRUE(ss.payload()->empty());
+}
+
+TEST(SingleSpawnerTest, SetPayloadTooLarge) {
+    // create new single_spawner object
+    mpicxx::single_spawner ss("a.out", 1);
+
+    // a payload whose size can't be represented by an int (never accessed)
+    const std::byte data{ 1 };
+    const std::size_t size = static_cast<std::size_t>(std::numeric_limits<int>::max()) + 1;
+    const std::span<const std::byte> payload(&data, size);
+
+    // try setting the payload
+    EXPECT_THROW_WHAT(
+            ss.set_payload(payload),
+            std::length_error,
+            fmt::format("The payload size (which is {}) is greater than the maximum possible size (which is {})!",
+                    size, std::numeric_limits<int>::max()));
+    EXPECT_FALSE(ss.payload().has_value());
+}
+
+TEST(SingleSpawnerTest, RemovePayload) {
+    // create new single_spawner object
+    mpicxx::single_spawner ss("a.out", 1);
+    ss.set_payload(std::vector<std::byte>{ std::byte{ 42 } });
+    ASSERT_TRUE(ss.payload().has_value());
+
+    // remove the payload
+    ss.remove_payload();
+    EXPECT_FALSE(ss.payload().has_value());
+}
+
+TEST(SingleSpawnerTest, GetPayload) {
+    // create new single_spawner object
+    mpicxx::single_spawner ss("a.out", 1);
+
+    // check getter
+    EXPECT_FALSE(ss.payload().has_value());
+}
+
+TEST(SingleSpawnerDeathTest, ReceivePayloadNoParent) {
+    // the current process hasn't been spawned
+    ASSERT_DEATH( [[maybe_unused]] const auto payload = mpicxx::receive_payload() , "");
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::single_spawner::spawn_async() const and
+ *        @ref mpicxx::single_spawner::spawn_async_with_errcodes() const member functions provided by the @ref mpicxx::single_spawner class.
+ * @details Testsuite: *SingleSpawnerTest*
+ * | test case name          | test case description                              |
+ * |:------------------------|:---------------------------------------------------|
+ * | SpawnAsyncThreadSupport | asynchronous spawning requires MPI_THREAD_MULTIPLE |
+ */
+
+#include <mpicxx/startup/init.hpp>
+#include <mpicxx/startup/single_spawner.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(SingleSpawnerTest, SpawnAsyncThreadSupport) {
+    // create new single_spawner object
+    mpicxx::single_spawner ss("a.out", 1);
+
+    // without MPI_THREAD_MULTIPLE asynchronous spawning must fail before spawning anything
+    if (mpicxx::provided_thread_support() != mpicxx::thread_support::multiple) {
+        EXPECT_THROW([[maybe_unused]] auto res = ss.spawn_async(), mpicxx::thread_support_not_satisfied);
+        EXPECT_THROW([[maybe_unused]] auto res = ss.spawn_async_with_errcodes(), mpicxx::thread_support_not_satisfied);
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::spawn_timings struct and the @ref mpicxx::spawn_statistics class.
+ * @details Testsuite: *StartupTest*
+ * | test case name            | test case description                                 |
+ * |:--------------------------|:------------------------------------------------------|
+ * | SpawnTimingsDurations     | check the durations of the different spawn phases     |
+ * | SpawnTimingsHandshake     | check the durations if a handshake has been performed |
+ * | SpawnPhaseToString        | check the conversion of a spawn phase to a string     |
+ * | SpawnStatisticsCount      | check the number of aggregated timings                |
+ * | SpawnStatisticsMean       | check the mean duration                               |
+ * | SpawnStatisticsPercentile | check the nearest-rank percentiles                    |
+ * | SpawnStatisticsMerge      | merge two statistics                                  |
+ * | SpawnStatisticsClear      | remove all aggregated timings                         |
+ */
+
+#include <mpicxx/startup/spawn_timings.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace std::string_literals;
+
+namespace {
+    // create spawn timings with the given durations (in seconds)
+    mpicxx::spawn_timings make_timings(const double marshalling, const double spawn) {
+        mpicxx::spawn_timings timings;
+        timings.marshalling_begin = mpicxx::clock::time_point(mpicxx::clock::duration(1.0));
+        timings.marshalling_end = timings.marshalling_begin + mpicxx::clock::duration(marshalling);
+        timings.spawn_end = timings.marshalling_end + mpicxx::clock::duration(spawn);
+        return timings;
+    }
+}
+
+TEST(StartupTest, SpawnTimingsDurations) {
+    // create spawn timings without handshake
+    const mpicxx::spawn_timings timings = make_timings(0.5, 2.0);
+
+    // check the durations
+    EXPECT_DOUBLE_EQ(timings.marshalling().count(), 0.5);
+    EXPECT_DOUBLE_EQ(timings.spawn().count(), 2.0);
+    EXPECT_FALSE(timings.handshake().has_value());
+    EXPECT_DOUBLE_EQ(timings.duration(mpicxx::spawn_phase::handshake).count(), 0.0);
+    EXPECT_DOUBLE_EQ(timings.total().count(), 2.5);
+}
+
+TEST(StartupTest, SpawnTimingsHandshake) {
+    // create spawn timings with handshake
+    mpicxx::spawn_timings timings = make_timings(0.5, 2.0);
+    timings.handshake_end = timings.spawn_end + mpicxx::clock::duration(1.0);
+
+    // check the durations
+    ASSERT_TRUE(timings.handshake().has_value());
+    EXPECT_DOUBLE_EQ(timings.handshake().value().count(), 1.0);
+    EXPECT_DOUBLE_EQ(timings.total().count(), 3.5);
+}
+
+TEST(StartupTest, SpawnPhaseToString) {
+    // conversion via fmt::format should work as expected
+    EXPECT_EQ(fmt::format("{}", mpicxx::spawn_phase::marshalling), "marshalling"s);
+    EXPECT_EQ(fmt::format("{}", mpicxx::spawn_phase::spawn), "spawn"s);
+    EXPECT_EQ(fmt::format("{}", mpicxx::spawn_phase::handshake), "handshake"s);
+    EXPECT_EQ(fmt::format("{}", mpicxx::spawn_phase::total), "total"s);
+}
+
+TEST(StartupTest, SpawnStatisticsCount) {
+    // create empty statistics
+    mpicxx::spawn_statistics stats;
+    EXPECT_EQ(stats.count(), 0);
+
+    // add timings with and without handshake
+    stats.add(make_timings(0.5, 1.0));
+    mpicxx::spawn_timings timings = make_timings(0.5, 1.0);
+    timings.handshake_end = timings.spawn_end;
+    stats.add(timings);
+
+    // the handshake phase should only be counted once
+    EXPECT_EQ(stats.count(), 2);
+    EXPECT_EQ(stats.count(mpicxx::spawn_phase::marshalling), 2);
+    EXPECT_EQ(stats.count(mpicxx::spawn_phase::spawn), 2);
+    EXPECT_EQ(stats.count(mpicxx::spawn_phase::handshake), 1);
+    EXPECT_EQ(stats.durations(mpicxx::spawn_phase::spawn).size(), 2);
+}
+
+TEST(StartupTest, SpawnStatisticsMean) {
+    // create statistics
+    mpicxx::spawn_statistics stats;
+    stats.add(make_timings(1.0, 1.0));
+    stats.add(make_timings(3.0, 2.0));
+
+    // check the mean durations
+    EXPECT_DOUBLE_EQ(stats.mean(mpicxx::spawn_phase::marshalling).count(), 2.0);
+    EXPECT_DOUBLE_EQ(stats.mean(mpicxx::spawn_phase::spawn).count(), 1.5);
+    EXPECT_DOUBLE_EQ(stats.mean().count(), 3.5);
+}
+
+TEST(StartupTest, SpawnStatisticsPercentile) {
+    // create statistics with the spawn durations 1, 2, ..., 10
+    mpicxx::spawn_statistics stats;
+    for (int i = 10; i > 0; --i) {
+        stats.add(make_timings(0.0, static_cast<double>(i)));
+    }
+
+    // check the percentiles
+    EXPECT_DOUBLE_EQ(stats.percentile(mpicxx::spawn_phase::spawn, 0.0).count(), 1.0);
+    EXPECT_DOUBLE_EQ(stats.percentile(mpicxx::spawn_phase::spawn, 50.0).count(), 5.0);
+    EXPECT_DOUBLE_EQ(stats.percentile(mpicxx::spawn_phase::spawn, 90.0).count(), 9.0);
+    EXPECT_DOUBLE_EQ(stats.percentile(mpicxx::spawn_phase::spawn, 95.0).count(), 10.0);
+    EXPECT_DOUBLE_EQ(stats.percentile(mpicxx::spawn_phase::spawn, 100.0).count(), 10.0);
+}
+
+TEST(StartupTest, SpawnStatisticsMerge) {
+    // create two statistics
+    mpicxx::spawn_statistics stats_1;
+    stats_1.add(make_timings(1.0, 1.0));
+    mpicxx::spawn_statistics stats_2;
+    stats_2.add(make_timings(2.0, 2.0));
+    stats_2.add(make_timings(3.0, 3.0));
+
+    // merge them
+    stats_1.merge(stats_2);
+    EXPECT_EQ(stats_1.count(), 3);
+    EXPECT_DOUBLE_EQ(stats_1.mean(mpicxx::spawn_phase::marshalling).count(), 2.0);
+    EXPECT_EQ(stats_2.count(), 2);
+}
+
+TEST(StartupTest, SpawnStatisticsClear) {
+    // create statistics
+    mpicxx::spawn_statistics stats;
+    stats.add(make_timings(1.0, 1.0));
+
+    // clear the statistics
+    stats.clear();
+    EXPECT_EQ(stats.count(), 0);
+    EXPECT_EQ(stats.count(mpicxx::spawn_phase::marshalling), 0);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::startup_report struct and the @ref mpicxx::startup_profiling class.
+ * @details Testsuite: *StartupTest*
+ * | test case name            | test case description                                        |
+ * |:--------------------------|:-------------------------------------------------------------|
+ * | StartupPhaseToString      | check the conversion of a startup phase to a string          |
+ * | StartupReportLine         | format a startup report as one-line summary                  |
+ * | StartupReportJson         | format a startup report as JSON                              |
+ * | StartupProfilingEnable    | enable and disable the startup profiling                     |
+ * | StartupProfilingEmptySink | enable the startup profiling with an empty sink (death test) |
+ */
+
+#include <mpicxx/startup/startup_report.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace std::string_literals;
+
+namespace {
+    // create a startup report with the given durations (in seconds)
+    mpicxx::startup_report make_report() {
+        mpicxx::startup_report report;
+        report.number_of_ranks = 4;
+        report.init = mpicxx::startup_phase_statistics{ mpicxx::clock::duration(1.0), mpicxx::clock::duration(3.0),
+                                                        mpicxx::clock::duration(2.0) };
+        report.main = mpicxx::startup_phase_statistics{ mpicxx::clock::duration(0.5), mpicxx::clock::duration(0.75),
+                                                        mpicxx::clock::duration(0.625) };
+        report.finalize = mpicxx::clock::duration(0.25);
+        return report;
+    }
+}
+
+TEST(StartupTest, StartupPhaseToString) {
+    // check the conversion of all startup phases
+    EXPECT_EQ(fmt::format("{}", mpicxx::startup_phase::init), "init"s);
+    EXPECT_EQ(fmt::format("{}", mpicxx::startup_phase::main), "main"s);
+    EXPECT_EQ(fmt::format("{}", mpicxx::startup_phase::finalize), "finalize"s);
+}
+
+TEST(StartupTest, StartupReportLine) {
+    const mpicxx::startup_report report = make_report();
+
+    // the one-line summary is the default format
+    const std::string line = "mpicxx startup report (4 ranks): init min=1.000000s max=3.000000s mean=2.000000s | "
+                             "main min=0.500000s max=0.750000s mean=0.625000s | finalize 0.250000s (rank 0)"s;
+    EXPECT_EQ(report.to_string(), line);
+    EXPECT_EQ(report.to_string(mpicxx::startup_report_format::line), line);
+}
+
+TEST(StartupTest, StartupReportJson) {
+    const mpicxx::startup_report report = make_report();
+
+    // format as a single JSON object
+    EXPECT_EQ(report.to_string(mpicxx::startup_report_format::json),
+              "{\"ranks\":4,\"init\":{\"min\":1.000000,\"max\":3.000000,\"mean\":2.000000},"
+              "\"main\":{\"min\":0.500000,\"max\":0.750000,\"mean\":0.625000},\"finalize\":0.250000}"s);
+}
+
+TEST(StartupTest, StartupProfilingEnable) {
+    // disabled by default
+    EXPECT_FALSE(mpicxx::startup_profiling::enabled());
+
+    // enable with a custom sink
+    std::string received;
+    mpicxx::startup_profiling::enable([&received](const std::string_view report) { received = report; },
+                                      mpicxx::startup_report_format::json);
+    EXPECT_TRUE(mpicxx::startup_profiling::enabled());
+    EXPECT_EQ(mpicxx::detail::startup_profiling_format, mpicxx::startup_report_format::json);
+    mpicxx::detail::startup_profiling_sink("report");
+    EXPECT_EQ(received, "report"s);
+
+    // enable with an output stream
+    std::stringstream ss;
+    mpicxx::startup_profiling::enable(ss);
+    EXPECT_TRUE(mpicxx::startup_profiling::enabled());
+    EXPECT_EQ(mpicxx::detail::startup_profiling_format, mpicxx::startup_report_format::line);
+    mpicxx::detail::startup_profiling_sink("report");
+    EXPECT_EQ(ss.str(), "report\n"s);
+
+    // disable again
+    mpicxx::startup_profiling::disable();
+    EXPECT_FALSE(mpicxx::startup_profiling::enabled());
+}
+
+TEST(StartupDeathTest, StartupProfilingEmptySink) {
+    // try to enable the profiling with an empty sink
+    ASSERT_DEATH( mpicxx::startup_profiling::enable(mpicxx::startup_profiling::sink_type{}) , "");
+}
\ No newline at end of file
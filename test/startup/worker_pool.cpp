@@ -0,0 +1,292 @@
+/**
+ * @file
+ * @author Marcel Breyer
+ * @date 2026-10-15
+ * @copyright This file is distributed under the MIT License.
+ *
+ * @brief Test cases for the @ref mpicxx::worker_pool class and the @ref mpicxx::worker_loop() function.
+ * @details Testsuite: *WorkerPoolTest*
+ * | test case name     | test case description                                                           |
+ * |:-------------------|:--------------------------------------------------------------------------------|
+ * | WorkerLoopNoParent | a process which hasn't been spawned can't be a worker                           |
+ * | TaskResult         | check the default state of a task result                                        |
+ * | SubmitAndWaitAny   | submit a task and wait for its result                                           |
+ * | Drain              | submit more tasks than workers and drain the pool                               |
+ * | FailureReplies     | exceptions thrown by the task handler are sent back as failed task results      |
+ * | Shutdown           | shutting down the pool returns the outstanding task results                     |
+ * | Grow               | add workers connected via another intercommunicator                             |
+ * | MalformedMessages  | messages with a foreign tag are left untouched, too short tasks are discarded   |
+ */
+
+#include <mpicxx/startup/worker_pool.hpp>
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    // connects rank 0 (the pool) with rank 1 (the worker); std::nullopt on all other ranks (or if there is only one rank)
+    std::optional<MPI_Comm> connect_worker() {
+        int rank, size;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        MPI_Comm_size(MPI_COMM_WORLD, &size);
+        if (size < 2 || rank > 1) {
+            return std::nullopt;
+        }
+        MPI_Comm intercomm;
+        MPI_Intercomm_create(MPI_COMM_SELF, 0, MPI_COMM_WORLD, rank == 0 ? 1 : 0, 0, &intercomm);
+        return intercomm;
+    }
+
+    // returns true on the rank owning the pool
+    bool is_pool_rank() {
+        int rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        return rank == 0;
+    }
+
+    // function id 0: reverse the payload, 1: throw a std::exception, 2: throw something else
+    std::vector<std::byte> handler(const mpicxx::worker_pool::function_id_type id, const std::span<const std::byte> payload) {
+        switch (id) {
+            case 0:
+                return std::vector<std::byte>(payload.rbegin(), payload.rend());
+            case 1:
+                throw std::runtime_error("failed");
+            case 2:
+                throw 42;
+            default:
+                return {};
+        }
+    }
+
+    std::string to_string(const std::vector<std::byte>& payload) {
+        return std::string(reinterpret_cast<const char*>(payload.data()), payload.size());
+    }
+
+    const std::vector<std::byte> payload = { std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+    const std::vector<std::byte> reversed_payload = { std::byte{ 3 }, std::byte{ 2 }, std::byte{ 1 } };
+}
+
+TEST(WorkerPoolTest, WorkerLoopNoParent) {
+    // the test processes haven't been spawned -> worker_loop() must fail without processing any task
+    bool called = false;
+    const auto handler = [&called](const mpicxx::worker_pool::function_id_type, const std::span<const std::byte> payload) {
+        called = true;
+        return std::vector<std::byte>(payload.begin(), payload.end());
+    };
+    EXPECT_THROW(mpicxx::worker_loop(handler), std::logic_error);
+    EXPECT_FALSE(called);
+}
+
+TEST(WorkerPoolTest, TaskResult) {
+    // a value initialized task result should be empty
+    const mpicxx::worker_task_result res{};
+    EXPECT_EQ(res.ticket, 0);
+    EXPECT_FALSE(res.succeeded);
+    EXPECT_TRUE(res.payload.empty());
+}
+
+TEST(WorkerPoolTest, SubmitAndWaitAny) {
+    // at least two ranks are needed
+    std::optional<MPI_Comm> intercomm = connect_worker();
+    if (!intercomm.has_value()) {
+        return;
+    }
+
+    if (is_pool_rank()) {
+        mpicxx::worker_pool pool(intercomm.value());
+        EXPECT_EQ(pool.size(), 1u);
+        EXPECT_EQ(pool.idle(), 1u);
+
+        // submit a task
+        const mpicxx::worker_pool::ticket_type ticket = pool.submit(0, payload);
+        EXPECT_EQ(ticket, 0u);
+        EXPECT_EQ(pool.idle(), 0u);
+        EXPECT_EQ(pool.in_flight(), 1u);
+
+        // wait for its result
+        const mpicxx::worker_task_result res = pool.wait_any();
+        EXPECT_EQ(res.ticket, ticket);
+        EXPECT_TRUE(res.succeeded);
+        EXPECT_EQ(res.payload, reversed_payload);
+        EXPECT_EQ(pool.idle(), 1u);
+        EXPECT_EQ(pool.in_flight(), 0u);
+
+        EXPECT_TRUE(pool.shutdown().empty());
+    } else {
+        EXPECT_EQ(mpicxx::worker_loop(intercomm.value(), &handler), 1u);
+    }
+}
+
+TEST(WorkerPoolTest, Drain) {
+    // at least two ranks are needed
+    std::optional<MPI_Comm> intercomm = connect_worker();
+    if (!intercomm.has_value()) {
+        return;
+    }
+
+    if (is_pool_rank()) {
+        mpicxx::worker_pool pool(intercomm.value());
+
+        // submit more tasks than workers (submit waits until the only worker is idle again)
+        for (mpicxx::worker_pool::ticket_type i = 0; i < 3; ++i) {
+            EXPECT_EQ(pool.submit(0, payload), i);
+        }
+
+        // drain the pool: the results are in the order they have been finished
+        const std::vector<mpicxx::worker_task_result> results = pool.drain();
+        ASSERT_EQ(results.size(), 3u);
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            SCOPED_TRACE(i);
+            EXPECT_EQ(results[i].ticket, i);
+            EXPECT_TRUE(results[i].succeeded);
+            EXPECT_EQ(results[i].payload, reversed_payload);
+        }
+        EXPECT_EQ(pool.idle(), 1u);
+        EXPECT_EQ(pool.in_flight(), 0u);
+
+        // draining again doesn't return anything
+        EXPECT_TRUE(pool.drain().empty());
+        EXPECT_TRUE(pool.shutdown().empty());
+    } else {
+        EXPECT_EQ(mpicxx::worker_loop(intercomm.value(), &handler), 3u);
+    }
+}
+
+TEST(WorkerPoolTest, FailureReplies) {
+    // at least two ranks are needed
+    std::optional<MPI_Comm> intercomm = connect_worker();
+    if (!intercomm.has_value()) {
+        return;
+    }
+
+    if (is_pool_rank()) {
+        mpicxx::worker_pool pool(intercomm.value());
+
+        // the task handler throws a std::exception
+        pool.submit(1, payload);
+        mpicxx::worker_task_result res = pool.wait_any();
+        EXPECT_FALSE(res.succeeded);
+        EXPECT_EQ(to_string(res.payload), "failed");
+
+        // the task handler throws something else
+        pool.submit(2, payload);
+        res = pool.wait_any();
+        EXPECT_FALSE(res.succeeded);
+        EXPECT_EQ(to_string(res.payload), "unknown exception");
+
+        // the worker continues processing tasks
+        pool.submit(0, payload);
+        res = pool.wait_any();
+        EXPECT_TRUE(res.succeeded);
+        EXPECT_EQ(res.payload, reversed_payload);
+
+        EXPECT_TRUE(pool.shutdown().empty());
+    } else {
+        EXPECT_EQ(mpicxx::worker_loop(intercomm.value(), &handler), 3u);
+    }
+}
+
+TEST(WorkerPoolTest, Shutdown) {
+    // at least two ranks are needed
+    std::optional<MPI_Comm> intercomm = connect_worker();
+    if (!intercomm.has_value()) {
+        return;
+    }
+
+    if (is_pool_rank()) {
+        mpicxx::worker_pool pool(intercomm.value());
+        const mpicxx::worker_pool::ticket_type ticket = pool.submit(0, payload);
+
+        // shutting down returns the not yet retrieved task result
+        const std::vector<mpicxx::worker_task_result> results = pool.shutdown();
+        ASSERT_EQ(results.size(), 1u);
+        EXPECT_EQ(results.front().ticket, ticket);
+        EXPECT_EQ(results.front().payload, reversed_payload);
+
+        // no workers remain
+        EXPECT_EQ(pool.size(), 0u);
+        EXPECT_EQ(pool.idle(), 0u);
+        EXPECT_EQ(pool.in_flight(), 0u);
+    } else {
+        EXPECT_EQ(mpicxx::worker_loop(intercomm.value(), &handler), 1u);
+    }
+}
+
+TEST(WorkerPoolTest, Grow) {
+    // at least two ranks are needed
+    std::optional<MPI_Comm> first_intercomm = connect_worker();
+    if (!first_intercomm.has_value()) {
+        return;
+    }
+    std::optional<MPI_Comm> second_intercomm = connect_worker();
+
+    if (is_pool_rank()) {
+        mpicxx::worker_pool pool(first_intercomm.value());
+        pool.submit(0, payload);
+        EXPECT_TRUE(pool.wait_any().succeeded);
+
+        // add a second worker
+        pool.grow(second_intercomm.value());
+        EXPECT_EQ(pool.size(), 2u);
+        EXPECT_EQ(pool.idle(), 2u);
+        EXPECT_EQ(pool.in_flight(), 0u);
+
+        // shut down the workers of both intercommunicators
+        EXPECT_TRUE(pool.shutdown().empty());
+        EXPECT_EQ(pool.size(), 0u);
+    } else {
+        // the same process serves both workers one after another
+        EXPECT_EQ(mpicxx::worker_loop(first_intercomm.value(), &handler), 1u);
+        EXPECT_EQ(mpicxx::worker_loop(second_intercomm.value(), &handler), 0u);
+    }
+}
+
+TEST(WorkerPoolTest, MalformedMessages) {
+    // at least two ranks are needed
+    std::optional<MPI_Comm> intercomm = connect_worker();
+    if (!intercomm.has_value()) {
+        return;
+    }
+    constexpr int foreign_tag = 32767;
+
+    if (is_pool_rank()) {
+        // a message with a foreign tag and a task message shorter than the task header
+        const int foreign = 42;
+        MPI_Send(&foreign, 1, MPI_INT, 0, foreign_tag, intercomm.value());
+        MPI_Send(payload.data(), static_cast<int>(payload.size()), MPI_BYTE, 0, mpicxx::detail::worker_pool_task_tag, intercomm.value());
+
+        mpicxx::worker_pool pool(intercomm.value());
+        pool.submit(3, payload);
+        const mpicxx::worker_task_result res = pool.wait_any();
+        EXPECT_EQ(res.ticket, 0u);
+        ASSERT_TRUE(res.succeeded);
+        ASSERT_EQ(res.payload.size(), 1u);
+        // the foreign message was still pending in the task handler
+        EXPECT_EQ(res.payload.front(), std::byte{ 1 });
+
+        EXPECT_TRUE(pool.shutdown().empty());
+    } else {
+        const MPI_Comm comm = intercomm.value();
+        const auto foreign_handler = [comm](const mpicxx::worker_pool::function_id_type, const std::span<const std::byte>) {
+            // the foreign message must not have been received by the worker_loop()
+            int flag;
+            MPI_Iprobe(0, foreign_tag, comm, &flag, MPI_STATUS_IGNORE);
+            if (flag != 0) {
+                int foreign;
+                MPI_Recv(&foreign, 1, MPI_INT, 0, foreign_tag, comm, MPI_STATUS_IGNORE);
+                flag = foreign == 42;
+            }
+            return std::vector<std::byte>{ static_cast<std::byte>(flag) };
+        };
+        // the malformed task isn't counted
+        EXPECT_EQ(mpicxx::worker_loop(comm, foreign_handler), 1u);
+    }
+}
\ No newline at end of file